@@ -1,6 +1,7 @@
 use actix_web::web;
 use crate::middleware::auth::AuthenticatedUser;
 
+pub mod batch;
 pub mod payments;
 pub mod customers;
 pub mod webhooks;
@@ -10,6 +11,7 @@ pub mod invoices;
 pub fn configure(cfg: &mut web::ServiceConfig) {
     cfg.service(
         web::scope("/v1")
+            .route("/batch", web::post().to(batch::handle_batch))
             .service(
                 web::scope("/payments")
                     .route("", web::post().to(payments::create_payment))
@@ -0,0 +1,145 @@
+use actix_web::{web, HttpRequest, HttpResponse, ResponseError};
+use serde::Deserialize;
+use serde_json::{json, Value};
+use tracing::info;
+use uuid::Uuid;
+
+use crate::{
+    errors::DefiantError,
+    models::CreatePaymentRequest,
+    services::{customer_service::CustomerService, payment_service::PaymentService},
+    AppState,
+};
+
+// Dispatch endpoint for the frontend RequestBatcher: every API call
+// issued in the same tick arrives as one envelope
+// {"requests": [{method, path, body}, ...]} and goes back as
+// {"responses": [{status, body}, ...]} in submission order — the client
+// resolves its futures positionally, so order is part of the contract.
+// A failing sub-request resolves to its own status/body pair instead of
+// failing the envelope.
+
+const MAX_BATCH_ENTRIES: usize = 50;
+
+#[derive(Deserialize)]
+pub struct BatchEnvelope {
+    requests: Vec<BatchEntry>,
+}
+
+#[derive(Deserialize)]
+pub struct BatchEntry {
+    method: String,
+    path: String,
+    #[serde(default)]
+    body: Value,
+}
+
+pub async fn handle_batch(
+    req: HttpRequest,
+    data: web::Json<BatchEnvelope>,
+    state: web::Data<AppState>,
+) -> Result<HttpResponse, DefiantError> {
+    let api_key = req
+        .headers()
+        .get("Authorization")
+        .and_then(|h| h.to_str().ok())
+        .and_then(|s| s.strip_prefix("Bearer "))
+        .ok_or_else(|| DefiantError::AuthenticationError("Missing API key".into()))?;
+
+    let envelope = data.into_inner();
+    if envelope.requests.len() > MAX_BATCH_ENTRIES {
+        return Err(DefiantError::ValidationError(format!(
+            "Batch exceeds {} entries",
+            MAX_BATCH_ENTRIES
+        )));
+    }
+
+    info!("Dispatching batch of {} sub-requests", envelope.requests.len());
+
+    let mut responses = Vec::with_capacity(envelope.requests.len());
+    for entry in &envelope.requests {
+        let (status, body) = match dispatch(entry, api_key, &state).await {
+            Ok(pair) => pair,
+            Err(e) => (
+                e.error_response().status().as_u16(),
+                json!({"error": e.to_string()}),
+            ),
+        };
+        responses.push(json!({"status": status, "body": body}));
+    }
+
+    Ok(HttpResponse::Ok().json(json!({"responses": responses})))
+}
+
+async fn dispatch(
+    entry: &BatchEntry,
+    api_key: &str,
+    state: &web::Data<AppState>,
+) -> Result<(u16, Value), DefiantError> {
+    match (entry.method.as_str(), entry.path.as_str()) {
+        ("POST", "/v1/payments") => {
+            let request: CreatePaymentRequest =
+                serde_json::from_value(entry.body.clone())
+                    .map_err(|e| DefiantError::BadRequest(e.to_string()))?;
+            request.validate()?;
+
+            let service = PaymentService::new(state.db.clone(), state.redis.clone());
+            let payment = service.create_payment(request, api_key).await?;
+            Ok((201, to_body(payment)?))
+        }
+        ("GET", "/v1/payments") => {
+            // The batcher carries query parameters in the body; empty
+            // strings mean "not set"
+            let cursor = str_field(&entry.body, "cursor").map(String::from);
+            let limit = entry.body.get("limit").and_then(Value::as_i64).unwrap_or(10);
+            let status = str_field(&entry.body, "status").map(String::from);
+            let customer_id = str_field(&entry.body, "customer_id")
+                .map(|s| s.parse::<Uuid>())
+                .transpose()
+                .map_err(|_| DefiantError::ValidationError("Invalid customer_id".into()))?;
+
+            let service = PaymentService::new(state.db.clone(), state.redis.clone());
+            let (payments, has_more, total) = service
+                .list_payments(api_key, cursor, limit, customer_id, status)
+                .await?;
+            Ok((
+                200,
+                json!({
+                    "data": to_body(payments)?,
+                    "has_more": has_more,
+                    "total": total,
+                }),
+            ))
+        }
+        ("GET", path) if path.starts_with("/v1/payments/") => {
+            let payment_id = parse_trailing_id(path, "/v1/payments/")?;
+            let service = PaymentService::new(state.db.clone(), state.redis.clone());
+            let payment = service.get_payment(payment_id, api_key).await?;
+            Ok((200, to_body(payment)?))
+        }
+        ("GET", path) if path.starts_with("/v1/customers/") => {
+            let customer_id = parse_trailing_id(path, "/v1/customers/")?;
+            let service = CustomerService::new(state.db.clone(), state.redis.clone());
+            let customer = service.get_customer(customer_id, api_key).await?;
+            Ok((200, to_body(customer)?))
+        }
+        (method, path) => Err(DefiantError::NotFound(format!(
+            "No batch route for {} {}",
+            method, path
+        ))),
+    }
+}
+
+fn str_field<'a>(body: &'a Value, key: &str) -> Option<&'a str> {
+    body.get(key).and_then(Value::as_str).filter(|s| !s.is_empty())
+}
+
+fn parse_trailing_id(path: &str, prefix: &str) -> Result<Uuid, DefiantError> {
+    path[prefix.len()..]
+        .parse()
+        .map_err(|_| DefiantError::ValidationError("Invalid id in batch path".into()))
+}
+
+fn to_body<T: serde::Serialize>(value: T) -> Result<Value, DefiantError> {
+    serde_json::to_value(value).map_err(|_| DefiantError::InternalError)
+}
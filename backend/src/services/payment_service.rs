@@ -112,7 +112,91 @@ impl PaymentService {
         
         self.payment_to_response(payment).await
     }
-    
+
+    pub async fn list_payments(
+        &self,
+        api_key: &str,
+        cursor: Option<String>,
+        limit: i64,
+        customer_id: Option<Uuid>,
+        status: Option<String>,
+    ) -> Result<(Vec<PaymentResponse>, bool, i64), DefiantError> {
+        let merchant = self.get_merchant_by_api_key(api_key).await?;
+
+        // Composite cursor "created_at,id" of the last payment on the
+        // previous page; the id breaks ties so bulk inserts sharing a
+        // timestamp are never skipped across a page boundary. A bare
+        // timestamp (legacy cursor) pairs with the nil uuid, which keeps
+        // the old strictly-before behavior.
+        let (cursor_ts, cursor_id): (Option<DateTime<Utc>>, Uuid) = match cursor {
+            Some(c) => {
+                let (ts_part, id_part) = match c.split_once(',') {
+                    Some((ts, id)) => (ts, Some(id)),
+                    None => (c.as_str(), None),
+                };
+                let ts = DateTime::parse_from_rfc3339(ts_part)
+                    .map_err(|_| DefiantError::ValidationError("Invalid cursor".into()))?
+                    .with_timezone(&Utc);
+                let id = id_part
+                    .map(|s| s.parse::<Uuid>())
+                    .transpose()
+                    .map_err(|_| DefiantError::ValidationError("Invalid cursor".into()))?
+                    .unwrap_or(Uuid::nil());
+                (Some(ts), id)
+            }
+            None => (None, Uuid::nil()),
+        };
+
+        let limit = limit.clamp(1, 100);
+
+        // Fetch one extra row to detect whether another page exists
+        let mut payments = sqlx::query_as!(
+            Payment,
+            r#"
+            SELECT * FROM payments
+            WHERE merchant_id = $1
+            AND ($2::uuid IS NULL OR customer_id = $2)
+            AND ($3::text IS NULL OR status::text = $3)
+            AND ($4::timestamptz IS NULL OR (created_at, id) < ($4, $5))
+            ORDER BY created_at DESC, id DESC
+            LIMIT $6
+            "#,
+            merchant.id,
+            customer_id,
+            status,
+            cursor_ts,
+            cursor_id,
+            limit + 1,
+        )
+        .fetch_all(&self.db.pool)
+        .await?;
+
+        let has_more = payments.len() as i64 > limit;
+        payments.truncate(limit as usize);
+
+        let total = sqlx::query_scalar!(
+            r#"
+            SELECT COUNT(*) FROM payments
+            WHERE merchant_id = $1
+            AND ($2::uuid IS NULL OR customer_id = $2)
+            AND ($3::text IS NULL OR status::text = $3)
+            "#,
+            merchant.id,
+            customer_id,
+            status,
+        )
+        .fetch_one(&self.db.pool)
+        .await?
+        .unwrap_or(0);
+
+        let mut responses = Vec::with_capacity(payments.len());
+        for payment in payments {
+            responses.push(self.payment_to_response(payment).await?);
+        }
+
+        Ok((responses, has_more, total))
+    }
+
     async fn process_card_payment(
         &self,
         payment: Payment,
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Minimal google-benchmark-style harness. No external dependency: each
+// benchmark registers itself with BENCHMARK()/BENCHMARK_RANGE(), the
+// runner calibrates the iteration count until a case runs long enough to
+// time, and results print as ns/op plus ops/s. Builds native (quick
+// iteration) and under Emscripten for node (numbers that match the wasm
+// production profile).
+
+namespace bench {
+
+class State {
+private:
+    size_t iterations_;
+    size_t index_ = 0;
+    int64_t range_;
+
+public:
+    State(size_t iterations, int64_t range)
+        : iterations_(iterations), range_(range) {}
+
+    bool keepRunning() { return index_++ < iterations_; }
+    int64_t range() const { return range_; }
+    size_t iterations() const { return iterations_; }
+};
+
+using Fn = void (*)(State&);
+
+struct Case {
+    std::string name;
+    Fn fn;
+    int64_t range;
+};
+
+inline std::vector<Case>& registry() {
+    static std::vector<Case> cases;
+    return cases;
+}
+
+struct Register {
+    Register(const char* name, Fn fn, int64_t range = 0) {
+        std::string label = name;
+        if (range > 0) {
+            label += "/" + std::to_string(range);
+        }
+        registry().push_back({label, fn, range});
+    }
+};
+
+// Keep the optimizer from deleting a benchmarked computation
+template <typename T>
+inline void doNotOptimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    volatile T sink = value;
+    (void)sink;
+#endif
+}
+
+inline double runOnce(const Case& c, size_t iterations) {
+    State state(iterations, c.range);
+    auto start = std::chrono::steady_clock::now();
+    c.fn(state);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+inline int runAll(const char* filter) {
+    std::printf("%-48s %15s %15s\n", "benchmark", "ns/op", "ops/s");
+    std::printf("%-48s %15s %15s\n", "---------", "-----", "-----");
+
+    for (const Case& c : registry()) {
+        if (filter && c.name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        // Calibrate: grow the iteration count until the case runs at
+        // least 200ms, then report from the final run
+        size_t iterations = 1;
+        double elapsed = runOnce(c, iterations);
+        while (elapsed < 0.2 && iterations < (size_t{1} << 30)) {
+            double scale = elapsed > 1e-6 ? 0.25 / elapsed : 1000.0;
+            iterations = static_cast<size_t>(iterations * scale) + 1;
+            elapsed = runOnce(c, iterations);
+        }
+
+        double ns_per_op = elapsed * 1e9 / static_cast<double>(iterations);
+        double ops_per_s = static_cast<double>(iterations) / elapsed;
+        std::printf("%-48s %15.1f %15.0f\n", c.name.c_str(), ns_per_op,
+                    ops_per_s);
+    }
+    return 0;
+}
+
+} // namespace bench
+
+#define BENCHMARK(fn) \
+    static ::bench::Register bench_reg_##fn(#fn, fn)
+#define BENCHMARK_RANGE(fn, range) \
+    static ::bench::Register bench_reg_##fn##_##range(#fn, fn, range)
@@ -0,0 +1,205 @@
+#include "bench.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "defiant/core/event_bus.hpp"
+#include "defiant/core/payment_store.hpp"
+#include "defiant/wasm/binary_protocol.hpp"
+#include "defiant_ffi.h"
+
+using namespace Defiant;
+
+// ====== Event bus dispatch ======
+
+static void BM_EventBusEmit(bench::State& state) {
+    EventBus bus;
+    int sink = 0;
+    for (int i = 0; i < 4; ++i) {
+        bus.subscribe<PaymentEvent>(EventType::PaymentCreated,
+                                    [&sink](const PaymentEvent& event) {
+                                        sink += static_cast<int>(event.amount);
+                                    });
+    }
+
+    PaymentEvent event{"pay_bench", 4999, "USD", "succeeded"};
+    while (state.keepRunning()) {
+        bus.emit(EventType::PaymentCreated, event);
+    }
+    bench::doNotOptimize(sink);
+}
+BENCHMARK(BM_EventBusEmit);
+
+static void BM_EventBusEmitNoListeners(bench::State& state) {
+    EventBus bus;
+    PaymentEvent event{"pay_bench", 4999, "USD", "succeeded"};
+    while (state.keepRunning()) {
+        bus.emit(EventType::PaymentCreated, event);
+    }
+}
+BENCHMARK(BM_EventBusEmitNoListeners);
+
+// ====== Table data path (PaymentStore::assign + page materialization;
+// the DOM half of Table::setData needs a browser) ======
+
+static std::vector<Payment> makePayments(int64_t count) {
+    std::vector<Payment> payments;
+    payments.reserve(static_cast<size_t>(count));
+    for (int64_t i = 0; i < count; ++i) {
+        Payment payment;
+        payment.id = "pay_" + std::to_string(i);
+        payment.amount = (i * 137) % 100000;
+        payment.currency = (i % 3) == 0 ? "EUR" : "USD";
+        payment.status = (i % 7) == 0 ? "failed" : "succeeded";
+        payments.push_back(std::move(payment));
+    }
+    return payments;
+}
+
+static void BM_PaymentStoreAssign(bench::State& state) {
+    std::vector<Payment> payments = makePayments(state.range());
+    PaymentStore store;
+    while (state.keepRunning()) {
+        store.assign(payments);
+    }
+    bench::doNotOptimize(store.size());
+}
+BENCHMARK_RANGE(BM_PaymentStoreAssign, 1000);
+BENCHMARK_RANGE(BM_PaymentStoreAssign, 10000);
+BENCHMARK_RANGE(BM_PaymentStoreAssign, 100000);
+
+static void BM_PaymentStorePageRows(bench::State& state) {
+    std::vector<Payment> payments = makePayments(state.range());
+    PaymentStore store;
+    store.assign(payments);
+    while (state.keepRunning()) {
+        auto rows = store.pageRows(0, 10);
+        bench::doNotOptimize(rows.size());
+    }
+}
+BENCHMARK_RANGE(BM_PaymentStorePageRows, 10000);
+
+// ====== WebSocket message parsing ======
+
+static std::vector<uint8_t> makeBinaryFrame() {
+    std::vector<uint8_t> frame;
+    frame.push_back(0xDF); // magic
+    frame.push_back(1);    // version
+    frame.push_back(static_cast<uint8_t>(EventType::WebSocketPaymentCreated));
+    frame.push_back(static_cast<uint8_t>(PaymentStatus::Succeeded));
+    int64_t amount = 4999;
+    frame.resize(frame.size() + 8);
+    std::memcpy(frame.data() + frame.size() - 8, &amount, 8);
+    auto appendString16 = [&frame](const char* s) {
+        uint16_t len = static_cast<uint16_t>(std::strlen(s));
+        frame.resize(frame.size() + 2);
+        std::memcpy(frame.data() + frame.size() - 2, &len, 2);
+        frame.insert(frame.end(), s, s + len);
+    };
+    appendString16("pay_1GqIC8tFWpcYl0Yd");
+    appendString16("USD");
+    return frame;
+}
+
+static void BM_BinaryFrameParse(bench::State& state) {
+    std::vector<uint8_t> bytes = makeBinaryFrame();
+    BinaryFrame frame;
+    while (state.keepRunning()) {
+        bool ok = parseBinaryFrame(bytes.data(), bytes.size(), frame);
+        bench::doNotOptimize(ok);
+    }
+}
+BENCHMARK(BM_BinaryFrameParse);
+
+static void BM_JsonMessageParse(bench::State& state) {
+    // The JSON fallback path of handleWebSocketMessage
+    std::string message =
+        R"({"type":"payment.created","data":{"id":"pay_1GqIC8tFWpcYl0Yd",)"
+        R"("amount":4999,"currency":"USD","status":"succeeded"}})";
+    while (state.keepRunning()) {
+        nlohmann::json data = nlohmann::json::parse(message);
+        bench::doNotOptimize(data.size());
+    }
+}
+BENCHMARK(BM_JsonMessageParse);
+
+// ====== Component id generation ======
+// Mirrors Component::generateId's per-call generator construction; the
+// baseline this measures is why ids should come from a cached generator
+
+static void BM_GenerateIdPerCallEngine(bench::State& state) {
+    while (state.keepRunning()) {
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_int_distribution<> dis(100000, 999999);
+        std::stringstream ss;
+        ss << "defiant-" << dis(gen);
+        bench::doNotOptimize(ss.str());
+    }
+}
+BENCHMARK(BM_GenerateIdPerCallEngine);
+
+static void BM_GenerateIdCachedEngine(bench::State& state) {
+    static std::mt19937 gen(std::random_device{}());
+    std::uniform_int_distribution<> dis(100000, 999999);
+    while (state.keepRunning()) {
+        char buf[24];
+        std::snprintf(buf, sizeof(buf), "defiant-%d", dis(gen));
+        bench::doNotOptimize(buf[0]);
+    }
+}
+BENCHMARK(BM_GenerateIdCachedEngine);
+
+static void BM_GenerateIdCounter(bench::State& state) {
+    // What Component::generateId does now: relaxed counter + snprintf
+    static std::atomic<uint32_t> next_id{1};
+    while (state.keepRunning()) {
+        char buf[20];
+        std::snprintf(buf, sizeof(buf), "comp_%u",
+                      next_id.fetch_add(1, std::memory_order_relaxed));
+        bench::doNotOptimize(buf[0]);
+    }
+}
+BENCHMARK(BM_GenerateIdCounter);
+
+// ====== FFI marshalling ======
+// Owned DefiantPaymentList shape: one heap string per field per record,
+// the cost defiant_list_payments_view exists to avoid
+
+static void BM_FfiPaymentListMarshal(bench::State& state) {
+    while (state.keepRunning()) {
+        const size_t count = static_cast<size_t>(state.range());
+        auto* payments = static_cast<DefiantPayment*>(
+            std::calloc(count, sizeof(DefiantPayment)));
+        for (size_t i = 0; i < count; ++i) {
+            payments[i].id = strdup("pay_1GqIC8tFWpcYl0Yd");
+            payments[i].amount = 4999;
+            payments[i].currency = strdup("USD");
+            payments[i].status = strdup("succeeded");
+            payments[i].payment_method = strdup("card");
+            payments[i].customer_id = strdup("cus_4QFJOjw2pOmAGJ");
+            payments[i].created_at = strdup("2026-08-29T12:00:00Z");
+        }
+        for (size_t i = 0; i < count; ++i) {
+            std::free(payments[i].id);
+            std::free(payments[i].currency);
+            std::free(payments[i].status);
+            std::free(payments[i].payment_method);
+            std::free(payments[i].customer_id);
+            std::free(payments[i].created_at);
+        }
+        std::free(payments);
+    }
+}
+BENCHMARK_RANGE(BM_FfiPaymentListMarshal, 1000);
+
+int main(int argc, char** argv) {
+    return bench::runAll(argc > 1 ? argv[1] : nullptr);
+}
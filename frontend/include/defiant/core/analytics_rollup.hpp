@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <nlohmann/json.hpp>
+
+#include "defiant/core/event_bus.hpp"
+
+namespace Defiant {
+
+// Client-side incremental analytics.
+//
+// The live revenue widget used to re-request the full analytics summary
+// every few seconds, and each poll re-scans the whole date range
+// server-side. Instead we take one snapshot (the /v1/analytics response
+// shape) and fold per-payment deltas from the event stream into it
+// locally, so the widget updates in O(1) per payment and polls nothing.
+struct AnalyticsSummary {
+    int64_t total_amount = 0;
+    int64_t total_count = 0;
+    int64_t successful_count = 0;
+    int64_t failed_count = 0;
+    int64_t refunded_amount = 0;
+    std::string start_date;
+    std::string end_date;
+
+    nlohmann::json toJson() const;
+};
+
+class AnalyticsRollup {
+public:
+    // Seed from a server snapshot; deltas arriving before the seed are
+    // folded into the zero summary and corrected by the next seed
+    void seed(const nlohmann::json& snapshot);
+    bool isSeeded() const { return seeded; }
+
+    // O(1) folds, called from the payment event paths in DefiantApp.
+    // `type` distinguishes a new payment from a status transition on an
+    // already-counted one. `payment_id` deduplicates: a payment created
+    // locally is echoed back over the WebSocket, and only the first of
+    // the two "created" deltas may count.
+    void applyPaymentDelta(EventType type, std::string_view payment_id,
+                           int64_t amount, std::string_view status);
+    void applyRefundDelta(int64_t amount);
+
+    const AnalyticsSummary& current() const { return summary; }
+
+    // Bumped on every applied delta; widgets compare this against their
+    // last-rendered value to skip redundant redraws
+    uint64_t version() const { return revision; }
+
+    void reset();
+
+private:
+    AnalyticsSummary summary;
+    bool seeded = false;
+    uint64_t revision = 0;
+
+    // Ids already counted as new; kept across seeds so a late echo of a
+    // pre-snapshot payment doesn't land on top of the snapshot
+    std::unordered_set<std::string> counted_payments;
+};
+
+} // namespace Defiant
@@ -1,8 +1,15 @@
 #include "defiant/core/app.hpp"
+#include "defiant/core/arena.hpp"
+#include "defiant/core/perf.hpp"
+#include "defiant/core/startup_snapshot.hpp"
+#include "defiant/wasm/binary_protocol.hpp"
+#include "defiant/wasm/ring_buffer.hpp"
 #include "defiant/utils/crypto.hpp"
 #include "defiant/utils/format.hpp"
+#include "defiant/ui/animations.hpp"
 #include <emscripten/val.h>
 #include <emscripten/fetch.h>
+#include <emscripten/html5.h>
 #include <cmath>
 #include <chrono>
 
@@ -11,10 +18,17 @@ namespace Defiant {
 DefiantApp::DefiantApp(const AppConfig& config) 
     : config(config), 
       api_client(std::make_unique<ApiClient>(config.api_url, config.api_key)),
+      request_batcher(std::make_unique<RequestBatcher>(config.api_url, config.api_key)),
       renderer(std::make_unique<WebGLRenderer>()),
       payment_form(nullptr),
       dashboard(nullptr) {
     
+    // Lifecycle events are page-visible; high-frequency payment/websocket
+    // events stay C++-only unless a caller opts them in
+    event_bus.enableJsDispatch(EventType::AppInitialized);
+    event_bus.enableJsDispatch(EventType::PaymentFormRendered);
+    event_bus.enableJsDispatch(EventType::DashboardRendered);
+
     // Initialize state
     app_state = nlohmann::json::object();
     app_state["initialized"] = false;
@@ -23,6 +37,10 @@ DefiantApp::DefiantApp(const AppConfig& config)
     
     // Load saved state from localStorage
     loadState();
+
+#if DEFIANT_PROFILING
+    Perf::instance().setEnabled(config.debug);
+#endif
 }
 
 DefiantApp::~DefiantApp() {
@@ -39,23 +57,63 @@ void DefiantApp::initialize() {
     // Create UI components
     payment_form = std::make_unique<PaymentForm>(*this);
     dashboard = std::make_unique<Dashboard>(*this);
-    
+
+    // Paint last session's dashboard dataset as soon as IDBFS syncs in;
+    // the network load behind it repaints with fresh data when it lands
+    SnapshotStore::loadAsync([this](bool ok, StartupSnapshot snapshot) {
+        if (!ok) {
+            return;
+        }
+        if (!analytics_rollup.isSeeded()) {
+            analytics_rollup.seed(snapshot.analytics.toJson());
+        }
+        if (payment_store.empty() && !snapshot.payments.empty()) {
+            payment_store.assign(snapshot.payments);
+            updateUI();
+        }
+        emit("snapshot.restored", {
+            {"payments", snapshot.payments.size()},
+            {"analytics", snapshot.analytics.toJson()}
+        });
+    });
+
     // Setup event listeners
     setupEventListeners();
     
     // Connect to WebSocket for real-time updates
     connectWebSocket();
+
+    // One rAF loop drives every animation: the tick advances the
+    // scheduler in C++ and the style writes ride the same per-frame DOM
+    // batch flush, replacing the old setTimeout trampolines
+    emscripten_request_animation_frame_loop(&DefiantApp::animationFrameTick,
+                                            this);
     
     // Update state
     app_state["initialized"] = true;
-    saveState();
+    saveStateSection("initialized");
     
     // Emit initialization event
-    emit("app.initialized", {{"timestamp", std::time(nullptr)}});
+    emitTyped(EventType::AppInitialized,
+              LifecycleEvent{static_cast<int64_t>(std::time(nullptr)), ""});
 }
 
 void DefiantApp::cleanup() {
     disconnectWebSocket();
+
+    // The async persistence pipeline may not get to run again; write out
+    // whatever is still dirty synchronously
+    state_store.flush();
+
+    // Persist the last-rendered dashboard dataset so the next session
+    // paints before its first network round-trip
+    if (!payment_store.empty() || analytics_rollup.isSeeded()) {
+        StartupSnapshot snapshot;
+        snapshot.analytics = analytics_rollup.current();
+        snapshot.payments = payment_store.materialize();
+        SnapshotStore::save(snapshot);
+    }
+
     if (renderer) {
         renderer->cleanup();
     }
@@ -129,10 +187,8 @@ PaymentResponse DefiantApp::createPayment(const PaymentRequest& request) {
     }
     
     // Emit event before creating payment
-    emit("payment.creating", {
-        {"amount", request.amount},
-        {"currency", request.currency}
-    });
+    emitTyped(EventType::PaymentCreating,
+              PaymentEvent{"", request.amount, request.currency, "creating"});
     
     // Make API call
     PaymentResponse response = api_client->createPayment(request);
@@ -144,17 +200,17 @@ PaymentResponse DefiantApp::createPayment(const PaymentRequest& request) {
         {"currency", response.currency},
         {"timestamp", std::time(nullptr)}
     };
-    
-    saveState();
+
+    // Only the last_payment subtree changed; don't rewrite the whole blob
+    saveStateSection("last_payment");
     
     // Emit event after creating payment
-    emit("payment.created", {
-        {"id", response.id},
-        {"amount", response.amount},
-        {"currency", response.currency},
-        {"status", response.status}
-    });
-    
+    emitTyped(EventType::PaymentCreated,
+              PaymentEvent{response.id, response.amount, response.currency,
+                           response.status});
+    analytics_rollup.applyPaymentDelta(EventType::PaymentCreated, response.id,
+                                       response.amount, response.status);
+
     return response;
 }
 
@@ -162,24 +218,161 @@ Customer DefiantApp::getCustomer(const std::string& customer_id) {
     return api_client->getCustomer(customer_id);
 }
 
+Task<PaymentResponse> DefiantApp::createPaymentAsync(PaymentRequest request) {
+    if (request.amount <= 0) {
+        throw std::invalid_argument("Amount must be positive");
+    }
+    if (request.currency.empty()) {
+        throw std::invalid_argument("Currency is required");
+    }
+
+    emitTyped(EventType::PaymentCreating,
+              PaymentEvent{"", request.amount, request.currency, "creating"});
+
+    BatchResult result = co_await awaitBatch(request_batcher->request(
+        "POST", "/v1/payments", {
+            {"amount", request.amount},
+            {"currency", request.currency}
+        }));
+
+    if (!result.ok()) {
+        throw std::runtime_error("createPayment failed: " +
+                                 result.body.value("error", "unknown error"));
+    }
+
+    PaymentResponse response;
+    response.id = result.body.value("id", "");
+    response.amount = result.body.value("amount", request.amount);
+    response.currency = result.body.value("currency", request.currency);
+    response.status = result.body.value("status", "pending");
+
+    app_state["last_payment"] = {
+        {"id", response.id},
+        {"amount", response.amount},
+        {"currency", response.currency},
+        {"timestamp", std::time(nullptr)}
+    };
+    saveStateSection("last_payment");
+
+    emitTyped(EventType::PaymentCreated,
+              PaymentEvent{response.id, response.amount, response.currency,
+                           response.status});
+    analytics_rollup.applyPaymentDelta(EventType::PaymentCreated, response.id,
+                                       response.amount, response.status);
+
+    co_return response;
+}
+
+Task<Customer> DefiantApp::getCustomerAsync(std::string customer_id) {
+    BatchResult result = co_await awaitBatch(request_batcher->request(
+        "GET", "/v1/customers/" + customer_id));
+
+    if (!result.ok()) {
+        throw std::runtime_error("getCustomer failed: " +
+                                 result.body.value("error", "unknown error"));
+    }
+
+    Customer customer;
+    customer.id = result.body.value("id", customer_id);
+    customer.email = result.body.value("email", "");
+    customer.name = result.body.value("name", "");
+    customer.balance = result.body.value("balance", int64_t{0});
+    co_return customer;
+}
+
+Task<std::vector<Payment>> DefiantApp::listPaymentsAsync(PaymentListQuery query) {
+    std::string cache_key = PaymentPageCache::normalizeKey(query);
+    if (const std::vector<Payment>* cached = payment_cache.get(cache_key)) {
+        payment_store.assign(*cached);
+        co_return *cached;
+    }
+
+    BatchResult result = co_await awaitBatch(request_batcher->request(
+        "GET", "/v1/payments", {
+            {"cursor", query.cursor},
+            {"limit", query.limit},
+            {"status", query.status},
+            {"customer_id", query.customer_id}
+        }));
+
+    if (!result.ok()) {
+        throw std::runtime_error("listPayments failed: " +
+                                 result.body.value("error", "unknown error"));
+    }
+
+    std::vector<Payment> payments;
+    if (result.body.contains("data") && result.body["data"].is_array()) {
+        payments.reserve(result.body["data"].size());
+        for (const auto& entry : result.body["data"]) {
+            Payment payment;
+            payment.id = entry.value("id", "");
+            payment.amount = entry.value("amount", int64_t{0});
+            payment.currency = entry.value("currency", "");
+            payment.status = entry.value("status", "");
+            payments.push_back(std::move(payment));
+        }
+    }
+
+    payment_store.assign(payments);
+    payment_cache.put(cache_key, payments);
+    co_return payments;
+}
+
 std::vector<Payment> DefiantApp::listPayments(const PaymentListQuery& query) {
-    return api_client->listPayments(query);
+    std::string cache_key = PaymentPageCache::normalizeKey(query);
+    if (const std::vector<Payment>* cached = payment_cache.get(cache_key)) {
+        payment_store.assign(*cached);
+        return *cached;
+    }
+
+    std::vector<Payment> payments = api_client->listPayments(query);
+    payment_store.assign(payments);
+    payment_cache.put(cache_key, payments);
+    return payments;
 }
 
 void DefiantApp::refundPayment(const std::string& payment_id, int64_t amount) {
     // Emit event before refund
-    emit("payment.refunding", {
-        {"payment_id", payment_id},
-        {"amount", amount}
-    });
-    
+    emitTyped(EventType::PaymentRefunding, RefundEvent{payment_id, amount});
+
     api_client->refundPayment(payment_id, amount);
-    
+
     // Emit event after refund
-    emit("payment.refunded", {
-        {"payment_id", payment_id},
-        {"amount", amount}
-    });
+    emitTyped(EventType::PaymentRefunded, RefundEvent{payment_id, amount});
+    analytics_rollup.applyRefundDelta(amount);
+}
+
+nlohmann::json DefiantApp::getPerfReport() {
+#if DEFIANT_PROFILING
+    return Perf::instance().report();
+#else
+    return {{"enabled", false}};
+#endif
+}
+
+nlohmann::json DefiantApp::getAnalytics(const std::string& start_date,
+                                        const std::string& end_date) {
+    // The rollup only tracks the default (live) range; explicit ranges
+    // are historical queries and go to the API unless they happen to
+    // match the seeded range exactly
+    if (!start_date.empty() || !end_date.empty()) {
+        const AnalyticsSummary& summary = analytics_rollup.current();
+        if (analytics_rollup.isSeeded() &&
+            summary.start_date == start_date && summary.end_date == end_date) {
+            return summary.toJson();
+        }
+        return api_client->getAnalytics(start_date, end_date);
+    }
+
+    // After the first snapshot the live summary is maintained from the
+    // event stream; repeat calls touch no network and cost O(1)
+    if (analytics_rollup.isSeeded()) {
+        return analytics_rollup.current().toJson();
+    }
+
+    nlohmann::json snapshot = api_client->getAnalytics(start_date, end_date);
+    analytics_rollup.seed(snapshot);
+    return analytics_rollup.current().toJson();
 }
 
 void DefiantApp::subscribe(const std::string& event_type, EventCallback callback) {
@@ -187,6 +380,7 @@ void DefiantApp::subscribe(const std::string& event_type, EventCallback callback
 }
 
 void DefiantApp::emit(const std::string& event_type, const nlohmann::json& data) {
+    DEFIANT_PERF_SCOPE("DefiantApp::emit");
     auto it = event_listeners.find(event_type);
     if (it != event_listeners.end()) {
         std::string data_str = data.dump();
@@ -225,9 +419,12 @@ void DefiantApp::connectWebSocket() {
     } else if (ws_url.find("https://") == 0) {
         ws_url.replace(0, 8, "wss://");
     }
-    ws_url += "/ws";
-    
-    api_client->connectWebSocket(ws_url, 
+    // Ask for the binary wire format; old servers ignore the parameter and
+    // keep sending JSON, which handleWebSocketMessage detects per frame
+    ws_url += "/ws?format=binary&proto_version=" +
+              std::to_string(kBinaryProtocolVersion);
+
+    api_client->connectWebSocket(ws_url,
         [this](const std::string& message) {
             handleWebSocketMessage(message);
         });
@@ -247,6 +444,16 @@ bool DefiantApp::validateCryptoPayment(const std::string& tx_hash) {
 }
 
 void DefiantApp::setupEventListeners() {
+    // Cached payment pages go stale the moment a payment changes, whether
+    // the mutation happened locally or arrived over the WebSocket
+    auto invalidate_cache = [this](EventType, const void*) {
+        payment_cache.invalidate();
+    };
+    event_bus.subscribeRaw(EventType::PaymentCreated, invalidate_cache);
+    event_bus.subscribeRaw(EventType::PaymentRefunded, invalidate_cache);
+    event_bus.subscribeRaw(EventType::WebSocketPaymentCreated, invalidate_cache);
+    event_bus.subscribeRaw(EventType::WebSocketPaymentUpdated, invalidate_cache);
+
     // Listen for DOM events
     emscripten::val document = emscripten::val::global("document");
     
@@ -269,14 +476,36 @@ void DefiantApp::setupEventListeners() {
 }
 
 void DefiantApp::handleWebSocketMessage(const std::string& message) {
+    DEFIANT_PERF_SCOPE("DefiantApp::handleWebSocketMessage");
+
+    // Binary frames parse in place out of the received buffer: no copy, no
+    // JSON parse, payload strings dispatched as views
+    if (handleBinaryFrame(reinterpret_cast<const uint8_t*>(message.data()),
+                          message.size())) {
+        return;
+    }
+
+    // JSON fallback for old servers
     try {
         nlohmann::json data = nlohmann::json::parse(message);
         std::string event_type = data["type"];
         
         // Process different event types
         if (event_type == "payment.created") {
+            payment_cache.invalidate();
+            analytics_rollup.applyPaymentDelta(
+                EventType::WebSocketPaymentCreated,
+                data["data"].value("id", ""),
+                data["data"].value("amount", int64_t{0}),
+                data["data"].value("status", ""));
             emit("websocket.payment.created", data["data"]);
         } else if (event_type == "payment.updated") {
+            payment_cache.invalidate();
+            analytics_rollup.applyPaymentDelta(
+                EventType::WebSocketPaymentUpdated,
+                data["data"].value("id", ""),
+                data["data"].value("amount", int64_t{0}),
+                data["data"].value("status", ""));
             emit("websocket.payment.updated", data["data"]);
         } else if (event_type == "invoice.paid") {
             emit("websocket.invoice.paid", data["data"]);
@@ -289,38 +518,79 @@ void DefiantApp::handleWebSocketMessage(const std::string& message) {
     }
 }
 
-void DefiantApp::loadState() {
-    try {
-        emscripten::val localStorage = emscripten::val::global("localStorage");
-        emscripten::val savedState = localStorage.call<emscripten::val>("getItem", 
-                                                                      emscripten::val("defiant_state"));
-        
-        if (!savedState.isUndefined() && !savedState.isNull()) {
-            std::string stateStr = savedState.as<std::string>();
-            app_state = nlohmann::json::parse(stateStr);
-        }
-    } catch (...) {
-        // If loading fails, use default state
-        app_state = nlohmann::json::object();
-        app_state["initialized"] = false;
+bool DefiantApp::handleBinaryFrame(const uint8_t* data, size_t length) {
+    BinaryFrame frame;
+    if (!parseBinaryFrame(data, length, frame)) {
+        return false;
+    }
+
+    switch (frame.type) {
+        case EventType::WebSocketPaymentCreated:
+        case EventType::WebSocketPaymentUpdated:
+            // Mirror the JSON path: drop cached pages before listeners
+            // run so anything they refetch sees fresh data
+            payment_cache.invalidate();
+            analytics_rollup.applyPaymentDelta(
+                frame.type, frame.payment.id, frame.payment.amount,
+                paymentStatusName(frame.payment.status));
+            [[fallthrough]];
+        case EventType::WebSocketInvoicePaid:
+        case EventType::WebSocketCustomerUpdated:
+            emitTyped(frame.type, frame.payment);
+            return true;
+        default:
+            // Well-formed frame for an event we don't route; swallow it so
+            // the JSON parser doesn't choke on binary data
+            return true;
     }
 }
 
+EM_BOOL DefiantApp::animationFrameTick(double time, void* user_data) {
+    DEFIANT_PERF_FRAME(time);
+
+    static double last_time = 0.0;
+    double delta = last_time > 0.0 ? (time - last_time) / 1000.0 : 0.0;
+    last_time = time;
+
+    // Pump worker results out of the shared ring first so anything they
+    // trigger (chart uploads, store updates) rides this frame's batch.
+    // The budget keeps a burst of deliveries from eating the frame.
+    WorkerTransport::instance().drain(16);
+
+    static_cast<DefiantApp*>(user_data)->updateAnimations(delta);
+    return EM_TRUE;
+}
+
+void DefiantApp::updateAnimations(double delta_time) {
+    // All active animations sit in one contiguous array; this steps them
+    // in C++ and queues the style writes into the frame's DOM batch
+    AnimationScheduler::instance().step(delta_time);
+
+    // Everything allocated from the frame arena during the previous tick
+    // (interpolated style strings, per-frame scratch buffers) is dead by
+    // now
+    FrameArena::reset();
+}
+
+void DefiantApp::loadState() {
+    state_store.load();
+}
+
 void DefiantApp::saveState() {
-    try {
-        emscripten::val localStorage = emscripten::val::global("localStorage");
-        localStorage.call<void>("setItem", 
-                               emscripten::val("defiant_state"),
-                               emscripten::val(app_state.dump()));
-    } catch (...) {
-        // Silently fail if localStorage is not available
-    }
+    // Marks everything dirty; the actual write is debounced, split per
+    // section, and serialized off the main thread
+    state_store.markAllDirty();
+}
+
+void DefiantApp::saveStateSection(const std::string& section) {
+    state_store.markDirty(section);
 }
 
 void DefiantApp::clearState() {
     app_state.clear();
     app_state["initialized"] = false;
-    saveState();
+    state_store.clearStorage();
+    state_store.flush();
 }
 
 } // namespace Defiant
\ No newline at end of file
@@ -6,9 +6,17 @@
 #include <unordered_map>
 #include <vector>
 #include <nlohmann/json.hpp>
+#include <emscripten/html5.h>
 
+#include "defiant/core/analytics_rollup.hpp"
+#include "defiant/core/event_bus.hpp"
+#include "defiant/core/payment_cache.hpp"
+#include "defiant/core/payment_store.hpp"
+#include "defiant/core/state_persistence.hpp"
+#include "defiant/core/task.hpp"
 #include "defiant/ui/components.hpp"
 #include "defiant/wasm/api_client.hpp"
+#include "defiant/wasm/request_batcher.hpp"
 #include "defiant/wasm/webgl_renderer.hpp"
 
 namespace Defiant {
@@ -28,7 +36,14 @@ class DefiantApp {
 private:
     AppConfig config;
     std::unique_ptr<ApiClient> api_client;
+    std::unique_ptr<RequestBatcher> request_batcher;
     std::unique_ptr<WebGLRenderer> renderer;
+    EventBus event_bus;
+    PaymentPageCache payment_cache;
+    PaymentStore payment_store;
+    AnalyticsRollup analytics_rollup;
+    // Legacy string-keyed listeners; interned events bridge into this map
+    // only when a listener is actually registered for the name
     std::unordered_map<std::string, std::vector<EventCallback>> event_listeners;
     
     // UI Components
@@ -38,6 +53,7 @@ private:
     // State
     std::string current_user;
     nlohmann::json app_state;
+    StatePersistence state_store{app_state};
     
 public:
     DefiantApp(const AppConfig& config);
@@ -57,11 +73,57 @@ public:
     Customer getCustomer(const std::string& customer_id);
     std::vector<Payment> listPayments(const PaymentListQuery& query);
     void refundPayment(const std::string& payment_id, int64_t amount);
+
+    // First call fetches a server snapshot; afterwards the summary is
+    // maintained locally from the payment event stream, so the revenue
+    // widget reads it in O(1) instead of re-polling the range
+    nlohmann::json getAnalytics(const std::string& start_date = "",
+                                const std::string& end_date = "");
+    AnalyticsRollup& analytics() { return analytics_rollup; }
+
+    // co_await-able variants: requests go through the batching layer and
+    // the coroutine resumes on the main loop, so UI code can overlap
+    // multiple in-flight calls without blocking or Asyncify
+    Task<PaymentResponse> createPaymentAsync(PaymentRequest request);
+    Task<Customer> getCustomerAsync(std::string customer_id);
+    Task<std::vector<Payment>> listPaymentsAsync(PaymentListQuery query);
     
     // Event System
     void subscribe(const std::string& event_type, EventCallback callback);
     void emit(const std::string& event_type, const nlohmann::json& data);
+
+    // Typed event bus: interned IDs, struct payloads by reference, JSON
+    // serialization and JS dispatch only when someone is listening
+    EventBus& events() { return event_bus; }
+
+    // Columnar view of the most recent listPayments result; Table and
+    // Chart consume this instead of copying rows around
+    const PaymentStore& paymentStore() const { return payment_store; }
+
+    // Same-tick request coalescing; Dashboard::loadData issues all its
+    // queries through this and they ship as one multiplexed fetch
+    RequestBatcher& batch() { return *request_batcher; }
+
+    template <typename Payload>
+    void emitTyped(EventType type, const Payload& payload) {
+        event_bus.emit(type, payload);
+
+        // Bridge to legacy string listeners; serialization happens only if
+        // a listener is registered under the string name
+        auto it = event_listeners.find(eventTypeName(type));
+        if (it != event_listeners.end() && !it->second.empty()) {
+            std::string data_str = payload.toJson().dump();
+            for (const auto& callback : it->second) {
+                callback(eventTypeName(type), data_str);
+            }
+        }
+    }
     
+    // Profiling (populated only in DEFIANT_PROFILING builds with
+    // config.debug set): per-scope timings, last frames' totals, and
+    // boundary call/byte counters as JSON
+    nlohmann::json getPerfReport();
+
     // Utility Methods
     std::string formatCurrency(int64_t amount, const std::string& currency);
     std::string generateQRCode(const std::string& data, int size = 200);
@@ -77,11 +139,15 @@ public:
 private:
     void setupEventListeners();
     void handleWebSocketMessage(const std::string& message);
+    bool handleBinaryFrame(const uint8_t* data, size_t length);
     void updateAnimations(double delta_time);
+    // Single rAF loop feeding updateAnimations with frame deltas
+    static EM_BOOL animationFrameTick(double time, void* user_data);
     
     // Internal state management
     void loadState();
     void saveState();
+    void saveStateSection(const std::string& section);
     void clearState();
 };
 
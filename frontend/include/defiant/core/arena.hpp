@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <utility>
+
+namespace Defiant {
+
+// Chunked bump allocator. Allocation is a pointer increment; individual
+// frees do not exist — the whole arena is rewound with reset(), which keeps
+// the underlying blocks so steady-state operation performs zero mallocs.
+// Under WASM this matters twice over: malloc churn is frame jank, and
+// ALLOW_MEMORY_GROWTH reallocs are brutal.
+class Arena {
+private:
+    struct Block {
+        std::unique_ptr<char[]> data;
+        size_t size;
+        size_t used;
+    };
+
+    std::vector<Block> blocks;
+    size_t block_size;
+    size_t current_block = 0;
+
+public:
+    explicit Arena(size_t blockSize = 64 * 1024);
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    // Rewind all blocks without releasing them
+    void reset();
+
+    // Construct a T inside the arena. Destructors are NOT run on reset();
+    // only use this for trivially-destructible payloads or objects whose
+    // lifetime ends with the arena.
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        void* mem = allocate(sizeof(T), alignof(T));
+        return new (mem) T(std::forward<Args>(args)...);
+    }
+
+    size_t bytesUsed() const;
+    size_t bytesReserved() const;
+
+private:
+    Block& grow(size_t minimum);
+};
+
+// std-compatible allocator adapter so containers (component child lists,
+// per-frame vectors) can live inside an arena. deallocate is a no-op.
+template <typename T>
+class ArenaAllocator {
+private:
+    Arena* arena;
+
+    template <typename U> friend class ArenaAllocator;
+
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena* arena) : arena(arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) {
+        // Bump allocator: memory is reclaimed by Arena::reset()
+    }
+
+    bool operator==(const ArenaAllocator& other) const { return arena == other.arena; }
+    bool operator!=(const ArenaAllocator& other) const { return arena != other.arena; }
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+// Long-lived arena backing component tree storage (child lists etc.).
+// Never reset while components are alive.
+class ComponentArena {
+public:
+    static Arena& get();
+};
+
+// Frame-scoped scratch arena for transient strings and buffers built on
+// hot paths (animation transition strings, class name assembly). Reset
+// once per updateAnimations tick; anything allocated from it is invalid
+// after the current frame.
+class FrameArena {
+public:
+    static Arena& get();
+    static void reset();
+
+    // printf-style formatter returning a NUL-terminated, frame-lifetime
+    // buffer. Avoids the std::to_string + operator+ temporary chains on
+    // every animation start.
+    static const char* format(const char* fmt, ...);
+};
+
+} // namespace Defiant
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace Defiant {
+
+// Compile-time interned event IDs. Dispatch is an array index instead of a
+// string hash + compare, and payloads travel as structs by reference — no
+// JSON round trip unless a JS listener is actually registered.
+enum class EventType : uint8_t {
+    AppInitialized,
+    PaymentCreating,
+    PaymentCreated,
+    PaymentRefunding,
+    PaymentRefunded,
+    PaymentFormRendered,
+    DashboardRendered,
+    WebSocketPaymentCreated,
+    WebSocketPaymentUpdated,
+    WebSocketInvoicePaid,
+    WebSocketCustomerUpdated,
+    WebSocketError,
+
+    Count // keep last
+};
+
+// Wire/DOM name for each event type ("payment.created", ...)
+const char* eventTypeName(EventType type);
+
+// Reverse lookup for the legacy string API; returns EventType::Count when
+// the name is not an interned event.
+EventType eventTypeFromName(std::string_view name);
+
+// Typed payloads for the hot paths. toJson() is only called when the event
+// actually has to cross into JS or reach a legacy string listener.
+struct PaymentEvent {
+    std::string id;
+    int64_t amount = 0;
+    std::string currency;
+    std::string status;
+
+    nlohmann::json toJson() const;
+};
+
+struct RefundEvent {
+    std::string payment_id;
+    int64_t amount = 0;
+
+    nlohmann::json toJson() const;
+};
+
+struct ErrorEvent {
+    std::string message;
+
+    nlohmann::json toJson() const;
+};
+
+struct LifecycleEvent {
+    int64_t timestamp = 0;
+    std::string detail;
+
+    nlohmann::json toJson() const;
+};
+
+class EventBus {
+public:
+    using RawCallback = std::function<void(EventType, const void* payload)>;
+
+    template <typename Payload>
+    void subscribe(EventType type, std::function<void(const Payload&)> callback) {
+        bindPayloadTag(type, payloadTag<Payload>());
+        listeners[index(type)].push_back(
+            [cb = std::move(callback)](EventType, const void* payload) {
+                cb(*static_cast<const Payload*>(payload));
+            });
+    }
+
+    void subscribeRaw(EventType type, RawCallback callback);
+
+    // Emit to C++ listeners by reference; serialize and dispatch a JS
+    // CustomEvent only if that was opted in for this event type.
+    template <typename Payload>
+    void emit(EventType type, const Payload& payload) {
+        bindPayloadTag(type, payloadTag<Payload>());
+        for (const auto& callback : listeners[index(type)]) {
+            callback(type, &payload);
+        }
+        if (js_dispatch[index(type)]) {
+            dispatchToJs(type, payload.toJson());
+        }
+    }
+
+    // JS CustomEvent dispatch is opt-in per event type; high-frequency
+    // events (websocket.*) should stay C++-only unless the page needs them.
+    void enableJsDispatch(EventType type, bool enabled = true);
+    bool jsDispatchEnabled(EventType type) const;
+
+    size_t listenerCount(EventType type) const;
+
+private:
+    static constexpr size_t kCount = static_cast<size_t>(EventType::Count);
+
+    static size_t index(EventType type) { return static_cast<size_t>(type); }
+
+    // One tag per payload struct; the static's address is the identity
+    template <typename Payload>
+    static const void* payloadTag() {
+        static const char tag = 0;
+        return &tag;
+    }
+
+    // Debug guard for the one-payload-struct-per-EventType contract.
+    // subscribe() casts the void* payload unchecked, so emitting a
+    // different struct on the same EventType is silent UB — the first
+    // typed subscribe/emit binds the type's tag, every later one must
+    // match. subscribeRaw listeners are outside the contract and get the
+    // raw pointer as-is.
+    void bindPayloadTag(EventType type, const void* tag) {
+#ifndef NDEBUG
+        const void*& bound = payload_tags[index(type)];
+        if (bound == nullptr) {
+            bound = tag;
+        }
+        assert(bound == tag &&
+               "EventBus: mismatched payload type for this EventType");
+#else
+        (void)type;
+        (void)tag;
+#endif
+    }
+
+    std::array<std::vector<RawCallback>, kCount> listeners;
+    std::array<bool, kCount> js_dispatch{};
+    std::array<const void*, kCount> payload_tags{};
+
+    void dispatchToJs(EventType type, const nlohmann::json& data);
+};
+
+} // namespace Defiant
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "defiant/wasm/api_client.hpp"
+
+namespace Defiant {
+
+// LRU cache of payment list pages keyed by the normalized query
+// (cursor, limit, status, customer filter). Paging back and forth in the
+// dashboard is served from memory instead of re-fetching identical pages;
+// any payment mutation observed locally or over the WebSocket invalidates
+// the whole cache, since a new payment can shift every page boundary.
+class PaymentPageCache {
+private:
+    struct Entry {
+        std::string key;
+        std::vector<Payment> payments;
+    };
+
+    size_t capacity;
+    std::list<Entry> lru; // front = most recently used
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+
+    size_t hit_count = 0;
+    size_t miss_count = 0;
+
+public:
+    explicit PaymentPageCache(size_t capacity = 32) : capacity(capacity) {}
+
+    // Canonical cache key for a query; field order is fixed so logically
+    // identical queries always collide
+    static std::string normalizeKey(const PaymentListQuery& query);
+
+    // Returns the cached page and marks it most-recently-used, or nullptr
+    // on a miss. The pointer is valid until the next put/invalidate.
+    const std::vector<Payment>* get(const std::string& key);
+
+    void put(const std::string& key, std::vector<Payment> payments);
+
+    void invalidate();
+
+    size_t size() const { return lru.size(); }
+    size_t hits() const { return hit_count; }
+    size_t misses() const { return miss_count; }
+};
+
+} // namespace Defiant
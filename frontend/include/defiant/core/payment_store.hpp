@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "defiant/wasm/api_client.hpp"
+#include "defiant/wasm/binary_protocol.hpp"
+
+namespace Defiant {
+
+// Columnar (struct-of-arrays) payment storage. listPayments results land
+// here once; Table and Chart consume views instead of each keeping its own
+// vector-of-vector-of-string copy. Amounts are a contiguous int64_t
+// column, statuses a small-int column, and currencies interned to uint16
+// tokens — sorting 50k rows by amount is one contiguous column sort over
+// an index vector, not 50k string-vector shuffles.
+class PaymentStore {
+private:
+    std::vector<std::string> ids_;
+    std::vector<int64_t> amounts_;
+    std::vector<PaymentStatus> statuses_;
+    std::vector<uint16_t> currencies_;
+
+    // Currency interning table; the handful of live currencies map to
+    // dense tokens indexing currency_names_
+    std::vector<std::string> currency_names_;
+    std::unordered_map<std::string, uint16_t> currency_index_;
+
+public:
+    // Replace the store contents with a fresh result set
+    void assign(const std::vector<Payment>& payments);
+    void clear();
+
+    size_t size() const { return amounts_.size(); }
+    bool empty() const { return amounts_.empty(); }
+
+    // Column views
+    const std::vector<int64_t>& amounts() const { return amounts_; }
+    const std::vector<PaymentStatus>& statuses() const { return statuses_; }
+    const std::vector<uint16_t>& currencyTokens() const { return currencies_; }
+
+    const std::string& id(size_t row) const { return ids_[row]; }
+    int64_t amount(size_t row) const { return amounts_[row]; }
+    PaymentStatus status(size_t row) const { return statuses_[row]; }
+    const std::string& currency(size_t row) const {
+        return currency_names_[currencies_[row]];
+    }
+
+    uint16_t internCurrency(const std::string& currency);
+
+    // Fill `order` with row indices sorted by the amount column. The data
+    // itself never moves; consumers index through the permutation.
+    void sortByAmount(bool ascending, std::vector<uint32_t>& order) const;
+    void sortByStatus(bool ascending, std::vector<uint32_t>& order) const;
+
+    // Aggregates for chart recomputation: single pass over one column
+    int64_t totalAmount() const;
+    int64_t minAmount() const;
+    int64_t maxAmount() const;
+
+    // Materialize display rows for one table page only (columns:
+    // id, amount, currency, status), optionally through a sort order
+    std::vector<std::vector<std::string>> pageRows(
+        size_t offset, size_t limit,
+        const std::vector<uint32_t>* order = nullptr) const;
+
+    // Reconstruct row structs from the columns (startup snapshot
+    // serialization; not for per-frame use)
+    std::vector<Payment> materialize() const;
+};
+
+} // namespace Defiant
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+
+// Frame-time and boundary-call instrumentation.
+//
+// Compiled in only when DEFIANT_PROFILING is set (the debug build flags
+// define it; release builds reduce every macro to a no-op and the
+// profiler is never referenced). At runtime the subsystem additionally
+// honours AppConfig::debug, so a debug binary with debug=false stays
+// quiet too.
+//
+// Usage on a hot path:
+//     DEFIANT_PERF_SCOPE("DefiantApp::emit");
+// and at the WASM<->JS boundary:
+//     DEFIANT_PERF_BOUNDARY_CALL(payload_bytes);
+
+#if !defined(DEFIANT_PROFILING)
+#define DEFIANT_PROFILING 0
+#endif
+
+namespace Defiant {
+
+class Perf {
+public:
+    static constexpr size_t kFrameHistory = 120;
+
+    struct ScopeStats {
+        uint64_t calls = 0;
+        double total_ms = 0.0;
+        double max_ms = 0.0;
+    };
+
+    struct FrameSample {
+        double total_ms = 0.0;
+        uint32_t boundary_calls = 0;
+        uint64_t boundary_bytes = 0;
+    };
+
+    static Perf& instance();
+
+    void setEnabled(bool on) { enabled = on; }
+    bool isEnabled() const { return enabled; }
+
+    // Called from the rAF tick; closes the previous frame's sample into
+    // the ring and opens the next one
+    void frameBoundary(double now_ms);
+
+    void recordScope(const char* name, double elapsed_ms);
+    void recordBoundaryCall(size_t bytes);
+
+    // Everything accumulated so far: per-scope totals plus the last
+    // kFrameHistory frames' timings
+    nlohmann::json report() const;
+    void reset();
+
+private:
+    Perf() = default;
+
+    bool enabled = false;
+    // Keyed by string literal address; every call site uses a literal
+    std::unordered_map<const char*, ScopeStats> scopes;
+    FrameSample frames[kFrameHistory] = {};
+    size_t frame_head = 0;
+    size_t frame_count = 0;
+    FrameSample current_frame;
+    double frame_start_ms = 0.0;
+    uint32_t total_boundary_calls = 0;
+    uint64_t total_boundary_bytes = 0;
+};
+
+#if DEFIANT_PROFILING
+
+class PerfScopedTimer {
+private:
+    const char* name;
+    double start_ms;
+
+public:
+    explicit PerfScopedTimer(const char* name);
+    ~PerfScopedTimer();
+};
+
+#define DEFIANT_PERF_CONCAT2(a, b) a##b
+#define DEFIANT_PERF_CONCAT(a, b) DEFIANT_PERF_CONCAT2(a, b)
+#define DEFIANT_PERF_SCOPE(name) \
+    ::Defiant::PerfScopedTimer DEFIANT_PERF_CONCAT(defiant_perf_, __LINE__)(name)
+#define DEFIANT_PERF_BOUNDARY_CALL(bytes) \
+    ::Defiant::Perf::instance().recordBoundaryCall(bytes)
+#define DEFIANT_PERF_FRAME(now_ms) \
+    ::Defiant::Perf::instance().frameBoundary(now_ms)
+
+#else
+
+#define DEFIANT_PERF_SCOPE(name) ((void)0)
+#define DEFIANT_PERF_BOUNDARY_CALL(bytes) ((void)0)
+#define DEFIANT_PERF_FRAME(now_ms) ((void)0)
+
+#endif // DEFIANT_PROFILING
+
+} // namespace Defiant
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "defiant/core/analytics_rollup.hpp"
+#include "defiant/wasm/api_client.hpp"
+
+namespace Defiant {
+
+// Startup snapshot for instant first paint.
+//
+// initialize() runs renderer/API/WebSocket setup in sequence and the
+// dashboard stays blank until loadData comes back from the network
+// (1.5-3s on a cold cache). On shutdown we serialize the last-rendered
+// dashboard dataset — the payments page and the analytics rollup — into
+// a compact binary blob in IDBFS; the next session decodes it straight
+// out of the (already synced) filesystem and paints the stale dashboard
+// immediately while fresh data loads behind it.
+struct StartupSnapshot {
+    AnalyticsSummary analytics;
+    std::vector<Payment> payments;
+};
+
+class SnapshotStore {
+public:
+    using LoadCallback = std::function<void(bool ok, StartupSnapshot snapshot)>;
+
+    // Mounts IDBFS (first call only), syncs it in from IndexedDB and
+    // decodes the previous session's snapshot. The callback runs on the
+    // main thread once the async syncfs completes; ok is false when no
+    // usable snapshot exists.
+    static void loadAsync(LoadCallback callback);
+
+    // Serializes to IDBFS and kicks off the background flush to
+    // IndexedDB. Cheap enough to call from cleanup().
+    static void save(const StartupSnapshot& snapshot);
+
+    // Wire format: same length-prefixed primitives as the binary
+    // WebSocket protocol, different magic. Exposed for the decoder's
+    // version checks; callers normally go through save/loadAsync.
+    static std::vector<uint8_t> encode(const StartupSnapshot& snapshot);
+    static bool decode(const uint8_t* data, size_t length, StartupSnapshot& out);
+};
+
+} // namespace Defiant
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <string>
+#include <unordered_set>
+#include <nlohmann/json.hpp>
+
+namespace Defiant {
+
+// Incremental localStorage persistence for app_state.
+//
+// Instead of synchronously serializing the whole state blob on every
+// mutation, callers mark the top-level sections they touched; a debounce
+// timer batches the writes, each section is stored under its own key
+// ("defiant_state.<section>"), and the JSON serialization runs on a single
+// long-lived writer thread — only the final localStorage.setItem is proxied
+// back to the main thread. A synchronous flush() remains for the shutdown
+// path.
+class StatePersistence {
+private:
+    nlohmann::json& state;
+    std::string key_prefix;
+    int debounce_ms;
+
+    std::unordered_set<std::string> dirty_sections;
+    bool all_dirty = false;
+    bool flush_pending = false;
+
+public:
+    explicit StatePersistence(nlohmann::json& state,
+                              std::string key_prefix = "defiant_state",
+                              int debounce_ms = 250);
+
+    // Mark one top-level subtree of the state as needing persistence and
+    // arm the debounce timer
+    void markDirty(const std::string& section);
+
+    // Mark every section dirty (legacy saveState path)
+    void markAllDirty();
+
+    // Synchronous flush on the calling (main) thread; used at shutdown
+    // where the async pipeline may not get to run
+    void flush();
+
+    // Populate state from the per-section keys, falling back to the old
+    // monolithic "defiant_state" blob written by previous releases
+    void load();
+
+    // Remove all persisted keys
+    void clearStorage();
+
+private:
+    void scheduleFlush();
+    void flushAsync();
+    static void onDebounceTimer(void* user_data);
+
+    std::string sectionKey(const std::string& section) const;
+    std::string indexKey() const;
+    void writeItem(const std::string& key, const std::string& value);
+};
+
+} // namespace Defiant
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <utility>
+
+#include "defiant/wasm/request_batcher.hpp"
+
+namespace Defiant {
+
+// Minimal coroutine task for UI code. Tasks start eagerly, run on the main
+// thread, and suspend only at co_await points, so multiple API calls can
+// be in flight concurrently without Asyncify's whole-program
+// instrumentation (or its ~30% size cost). A Task that is destroyed while
+// still running detaches and cleans itself up at completion.
+template <typename T>
+class Task {
+public:
+    struct promise_type {
+        std::optional<T> value;
+        std::exception_ptr error;
+        std::coroutine_handle<> continuation;
+        bool detached = false;
+
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_never initial_suspend() noexcept { return {}; }
+
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+            std::coroutine_handle<> await_suspend(
+                std::coroutine_handle<promise_type> handle) noexcept {
+                auto& promise = handle.promise();
+                if (promise.continuation) {
+                    return promise.continuation;
+                }
+                if (promise.detached) {
+                    handle.destroy();
+                }
+                return std::noop_coroutine();
+            }
+            void await_resume() noexcept {}
+        };
+
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        void return_value(T result) { value = std::move(result); }
+        void unhandled_exception() { error = std::current_exception(); }
+    };
+
+    Task() = default;
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+
+    Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            release();
+            handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() { release(); }
+
+    bool done() const { return !handle || handle.done(); }
+
+    // Awaiting a Task resumes the awaiter when the task finishes
+    bool await_ready() const { return done(); }
+    void await_suspend(std::coroutine_handle<> awaiter) {
+        handle.promise().continuation = awaiter;
+    }
+    T await_resume() {
+        if (handle.promise().error) {
+            std::rethrow_exception(handle.promise().error);
+        }
+        return std::move(*handle.promise().value);
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle = nullptr;
+
+    void release() {
+        if (!handle) {
+            return;
+        }
+        if (handle.done()) {
+            handle.destroy();
+        } else {
+            // Still running: let the frame destroy itself at final_suspend
+            handle.promise().detached = true;
+        }
+        handle = nullptr;
+    }
+};
+
+template <>
+class Task<void> {
+public:
+    struct promise_type {
+        std::exception_ptr error;
+        std::coroutine_handle<> continuation;
+        bool detached = false;
+
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_never initial_suspend() noexcept { return {}; }
+
+        struct FinalAwaiter {
+            bool await_ready() noexcept { return false; }
+            std::coroutine_handle<> await_suspend(
+                std::coroutine_handle<promise_type> handle) noexcept {
+                auto& promise = handle.promise();
+                if (promise.continuation) {
+                    return promise.continuation;
+                }
+                if (promise.detached) {
+                    handle.destroy();
+                }
+                return std::noop_coroutine();
+            }
+            void await_resume() noexcept {}
+        };
+
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        void return_void() {}
+        void unhandled_exception() { error = std::current_exception(); }
+    };
+
+    Task() = default;
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+
+    Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            release();
+            handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() { release(); }
+
+    bool done() const { return !handle || handle.done(); }
+
+    bool await_ready() const { return done(); }
+    void await_suspend(std::coroutine_handle<> awaiter) {
+        handle.promise().continuation = awaiter;
+    }
+    void await_resume() {
+        if (handle.promise().error) {
+            std::rethrow_exception(handle.promise().error);
+        }
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle = nullptr;
+
+    void release() {
+        if (!handle) {
+            return;
+        }
+        if (handle.done()) {
+            handle.destroy();
+        } else {
+            handle.promise().detached = true;
+        }
+        handle = nullptr;
+    }
+};
+
+// Awaiter adapter for the batching layer: co_await on a BatchFuture
+// suspends until the multiplexed response arrives on the main thread.
+struct BatchAwaiter {
+    BatchFuture future;
+
+    bool await_ready() const { return future.ready(); }
+    void await_suspend(std::coroutine_handle<> handle) {
+        future.then([handle](const BatchResult&) mutable { handle.resume(); });
+    }
+    BatchResult await_resume() { return future.result(); }
+};
+
+inline BatchAwaiter awaitBatch(BatchFuture future) {
+    return BatchAwaiter{std::move(future)};
+}
+
+// Single-threaded executor pumped from the browser event loop. post()
+// schedules a callable on the next tick; coroutines resumed through it
+// always run on the main thread.
+class MainLoopExecutor {
+public:
+    static MainLoopExecutor& instance();
+
+    void post(std::function<void()> fn);
+
+    // Awaitable that reschedules the coroutine onto the next event-loop
+    // tick (yield point for long-running work)
+    struct ScheduleAwaiter {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle);
+        void await_resume() const noexcept {}
+    };
+
+    ScheduleAwaiter schedule() { return {}; }
+};
+
+} // namespace Defiant
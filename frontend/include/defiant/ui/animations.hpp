@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Defiant {
+
+// Animation scheduler driven by a single requestAnimationFrame tick.
+//
+// fadeIn/slideIn/hide used to chain style flips through nested setTimeout
+// trampolines — several boundary crossings per animation, firing at
+// arbitrary phases relative to the frame. All active animations now live
+// in one contiguous array; DefiantApp's rAF tick advances them in C++
+// and the resulting style writes go through the DOM batch, so a frame
+// with twenty running animations still costs one flush.
+
+enum class AnimProperty : uint8_t {
+    Opacity,
+    TranslateX,
+    TranslateY
+};
+
+struct ActiveAnimation {
+    std::string target;  // element id; resolved by the DOM batch on flush
+    AnimProperty property = AnimProperty::Opacity;
+    double from = 0.0;
+    double to = 1.0;
+    double elapsed = 0.0;   // seconds
+    double duration = 0.3;  // seconds
+    bool hide_on_end = false;  // hide(): flip display:none after the fade
+};
+
+class AnimationScheduler {
+private:
+    std::vector<ActiveAnimation> animations;
+
+    AnimationScheduler() = default;
+
+public:
+    static AnimationScheduler& instance();
+
+    // Start (or restart — same target and property replaces) an animation
+    void animate(const std::string& target, AnimProperty property,
+                 double from, double to, double duration,
+                 bool hide_on_end = false);
+
+    // Drop every animation on a target; used when its element goes away
+    void cancel(const std::string& target);
+
+    // Advance all animations by delta_time seconds and queue the style
+    // writes. Called once per frame from DefiantApp::updateAnimations.
+    void step(double delta_time);
+
+    bool idle() const { return animations.empty(); }
+    size_t activeCount() const { return animations.size(); }
+};
+
+} // namespace Defiant
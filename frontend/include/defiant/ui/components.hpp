@@ -4,9 +4,16 @@
 #include <vector>
 #include <functional>
 #include <memory>
+#include <unordered_map>
 #include <emscripten/val.h>
 #include <nlohmann/json.hpp>
 
+#include "defiant/core/arena.hpp"
+#include "defiant/ui/hydration.hpp"
+#include "defiant/utils/validation.hpp"
+#include "defiant/ui/vdom.hpp"
+#include "defiant/wasm/chart_worker.hpp"
+
 namespace Defiant {
 
 // Color scheme
@@ -34,8 +41,9 @@ protected:
     emscripten::val element;
     std::string id;
     bool visible = true;
+    bool hydrated = true;  // false between renderLazy() and hydration
     AnimationSettings animation;
-    
+
 public:
     Component(const std::string& id = "");
     virtual ~Component();
@@ -44,6 +52,15 @@ public:
     virtual void render(emscripten::val parent) = 0;
     virtual void update() = 0;
     virtual void destroy();
+
+    // Lazy hydration: drops a lightweight placeholder into the parent and
+    // defers the real render() (and whatever data load it triggers) until
+    // the viewport scheduler reports the placeholder near the fold.
+    // Priority orders hydration when several widgets become visible at
+    // once — the payments table before footer charts.
+    void renderLazy(emscripten::val parent,
+                    HydrationPriority priority = HydrationPriority::Normal);
+    bool isHydrated() const { return hydrated; }
     
     // Visibility
     void show();
@@ -62,6 +79,12 @@ public:
     void removeClass(const std::string& className);
     void setStyle(const std::string& property, const std::string& value);
     void setAttribute(const std::string& name, const std::string& value);
+
+    // Token overloads: hot update paths pass pre-interned integers across
+    // the boundary instead of building class-name strings per call
+    void addClass(DomToken token);
+    void removeClass(DomToken token);
+    void setStyle(DomToken property, const std::string& value);
     
     // Events
     void addEventListener(const std::string& event, emscripten::val callback);
@@ -69,7 +92,7 @@ public:
     
     // Getters
     emscripten::val getElement() const { return element; }
-    std::string getId() const { return id; }
+    const std::string& getId() const { return id; }
     
 protected:
     void createElement(const std::string& tag);
@@ -86,7 +109,12 @@ private:
     std::string size = "medium"; // small, medium, large
     bool disabled = false;
     bool loading = false;
-    
+
+    // Currently-applied class tokens; update() swaps only what changed
+    // instead of probing every variant/size class
+    DomToken applied_variant = 0;
+    DomToken applied_size = 0;
+
 public:
     Button(const std::string& text, 
            const std::function<void()>& onClick = nullptr,
@@ -95,14 +123,16 @@ public:
     void render(emscripten::val parent) override;
     void update() override;
     
-    void setText(const std::string& newText);
-    void setVariant(const std::string& newVariant);
-    void setSize(const std::string& newSize);
+    // Sink setters: pass an rvalue (or a value you are done with) and the
+    // string moves straight into the member
+    void setText(std::string newText);
+    void setVariant(std::string newVariant);
+    void setSize(std::string newSize);
     void setDisabled(bool isDisabled);
     void setLoading(bool isLoading);
-    
-    std::string getText() const { return text; }
-    std::string getVariant() const { return variant; }
+
+    const std::string& getText() const { return text; }
+    const std::string& getVariant() const { return variant; }
 };
 
 // Input component
@@ -117,7 +147,10 @@ private:
     bool disabled = false;
     std::function<void(const std::string&)> onChange;
     std::function<void(const std::string&)> onBlur;
-    
+    // Compiled rule program; defaults to the program for `type` and can
+    // be overridden per field (e.g. a card input typed "text")
+    const CompiledValidator* validator = nullptr;
+
 public:
     Input(const std::string& type = "text",
           const std::string& id = "");
@@ -125,18 +158,21 @@ public:
     void render(emscripten::val parent) override;
     void update() override;
     
-    void setValue(const std::string& newValue);
-    void setPlaceholder(const std::string& newPlaceholder);
-    void setLabel(const std::string& newLabel);
-    void setError(const std::string& newError);
+    void setValue(std::string newValue);
+    void setPlaceholder(std::string newPlaceholder);
+    void setLabel(std::string newLabel);
+    void setError(std::string newError);
     void setRequired(bool isRequired);
     void setDisabled(bool isDisabled);
-    
-    std::string getValue() const { return value; }
+    void setValidator(const CompiledValidator* rules);
+
+    const std::string& getValue() const { return value; }
     bool isValid() const { return error.empty(); }
-    
+
 private:
     void validate();
+    // Writes only the error slot, and only when the message changed
+    void updateErrorSlot();
 };
 
 // Card component
@@ -144,7 +180,9 @@ class Card : public Component {
 private:
     std::string title;
     std::string subtitle;
-    std::vector<std::shared_ptr<Component>> children;
+    // Child list storage lives in the long-lived component arena
+    ArenaVector<std::shared_ptr<Component>> children{
+        ArenaAllocator<std::shared_ptr<Component>>(&ComponentArena::get())};
     bool shadow = true;
     bool bordered = true;
     std::string headerAction;
@@ -156,20 +194,24 @@ public:
     void render(emscripten::val parent) override;
     void update() override;
     
-    void setTitle(const std::string& newTitle);
-    void setSubtitle(const std::string& newSubtitle);
+    void setTitle(std::string newTitle);
+    void setSubtitle(std::string newSubtitle);
+    // Sink overload: the card takes sole ownership with no refcount
+    // traffic; keep the shared_ptr form when the caller retains a handle
+    void addChild(std::unique_ptr<Component> child);
     void addChild(std::shared_ptr<Component> child);
     void clearChildren();
     void setShadow(bool hasShadow);
     void setBordered(bool hasBorder);
-    void setHeaderAction(const std::string& action);
+    void setHeaderAction(std::string action);
 };
 
 // Modal component
 class Modal : public Component {
 private:
     std::string title;
-    std::vector<std::shared_ptr<Component>> children;
+    ArenaVector<std::shared_ptr<Component>> children{
+        ArenaAllocator<std::shared_ptr<Component>>(&ComponentArena::get())};
     bool open = false;
     std::function<void()> onClose;
     std::string size = "medium"; // small, medium, large, full
@@ -187,11 +229,12 @@ public:
     void toggleModal();
     bool isOpen() const { return open; }
     
-    void setTitle(const std::string& newTitle);
+    void setTitle(std::string newTitle);
+    void addChild(std::unique_ptr<Component> child);
     void addChild(std::shared_ptr<Component> child);
     void clearChildren();
-    void setSize(const std::string& newSize);
-    void setOnClose(const std::function<void()>& callback);
+    void setSize(std::string newSize);
+    void setOnClose(std::function<void()> callback);
     
 private:
     void setupOverlay();
@@ -212,6 +255,12 @@ private:
     int totalItems = 0;
     std::function<void(int, const std::string&)> onRowClick;
     std::function<void(int, int)> onPageChange;
+
+    // Keyed reconciliation state: when keyColumn >= 0, setData diffs the
+    // incoming rows against the previous data by that column and patches
+    // only changed cells instead of rebuilding the table DOM.
+    int keyColumn = -1;
+    std::unordered_map<std::string, emscripten::val> rowNodes;
     
 public:
     Table(const std::vector<std::string>& headers = {},
@@ -221,8 +270,12 @@ public:
     void update() override;
     
     void setData(const std::vector<std::vector<std::string>>& newData);
-    void setHeaders(const std::vector<std::string>& newHeaders);
-    void setActions(const std::vector<std::string>& newActions);
+    // Rvalue overload adopts the row storage outright; feeding a 10k-row
+    // listPayments result in moves every cell instead of deep-copying it
+    void setData(std::vector<std::vector<std::string>>&& newData);
+    void setKeyColumn(int column);
+    void setHeaders(std::vector<std::string> newHeaders);
+    void setActions(std::vector<std::string> newActions);
     void setStriped(bool isStriped);
     void setHoverable(bool isHoverable);
     void setSortable(bool isSortable);
@@ -238,6 +291,12 @@ private:
     void renderBody();
     void renderPagination();
     std::vector<std::vector<std::string>> getPageData();
+
+    // Keyed reconciliation helpers
+    void reconcileRows(const std::vector<std::vector<std::string>>& oldRows,
+                       const std::vector<std::vector<std::string>>& newRows);
+    void indexRowNodes();
+    emscripten::val createRowNode(const std::vector<std::string>& row);
 };
 
 // Chart component (using WebGL)
@@ -249,11 +308,23 @@ private:
     std::unique_ptr<WebGLRenderer> renderer;
     int width = 400;
     int height = 300;
-    
+
+    // Worker-prepared geometry; renderChart uploads this instead of
+    // recomputing on the main thread
+    ChartVertexBuffer vertex_buffer;
+    // Shared-renderer mode: all charts draw through one batched context
+    static bool use_shared_renderer;
+    int shared_handle = -1;
+    // Outstanding worker results check this token so a destroyed chart
+    // never gets a late delivery
+    std::shared_ptr<bool> alive = std::make_shared<bool>(true);
+
+
 public:
     Chart(const std::string& type = "line",
           const std::string& id = "");
-    
+    ~Chart() override;
+
     void render(emscripten::val parent) override;
     void update() override;
     void destroy() override;
@@ -265,38 +336,56 @@ public:
     
     void updateData(const nlohmann::json& newData);
     void animate();
-    
+
+    const ChartVertexBuffer& getVertexBuffer() const { return vertex_buffer; }
+
+    // When enabled, charts created afterwards register with the shared
+    // batched renderer instead of each owning a WebGLRenderer/GL context
+    static void setUseSharedRenderer(bool enabled);
+
 private:
     void setupCanvas();
     void renderChart();
     void cleanupChart();
+
+    // Extracts the series and dispatches binning/downsampling/min-max to
+    // the worker pool; only the finished vertex buffer touches this thread
+    void prepareDataAsync();
 };
 
 // Notification system
+//
+// Toasts render into a fixed-size ring of recycled DOM nodes: a slot's
+// node is created once and reused for every toast that passes through it,
+// so insert and expire are O(1) and the DOM never grows with arrival
+// rate. When payments arrive faster than slots free up, the excess is
+// coalesced into a single "+N more" summary instead of a node per toast.
 class Notification {
-private:
-    static std::vector<Notification> notifications;
-    
-    std::string id;
-    std::string title;
-    std::string message;
-    std::string type; // success, error, warning, info
-    int duration = 5000; // ms
-    bool closable = true;
-    
 public:
-    static void show(const std::string& title, 
-                     const std::string& message, 
+    static constexpr int kMaxVisible = 5;
+    static constexpr int kDefaultDuration = 5000; // ms
+
+    static void show(const std::string& title,
+                     const std::string& message,
                      const std::string& type = "info");
     static void success(const std::string& title, const std::string& message);
     static void error(const std::string& title, const std::string& message);
     static void warning(const std::string& title, const std::string& message);
     static void info(const std::string& title, const std::string& message);
     static void clearAll();
-    
+
+    // Timer callback (bound for the JS setTimeout); frees the slot and
+    // folds any coalesced overflow back into it
+    static void expireSlot(int slot);
+
 private:
-    void render();
-    void remove();
+    static void ensureContainer();
+    static int acquireSlot();
+    static void renderSlot(int slot,
+                           const std::string& title,
+                           const std::string& message,
+                           const std::string& type);
+    static void updateOverflowSummary();
 };
 
 } // namespace Defiant
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Defiant {
+
+// Viewport-driven lazy hydration.
+//
+// renderDashboard used to build every widget and fetch its data up
+// front (~1200 DOM nodes) even though most of the page is below the
+// fold. Components can instead drop a lightweight placeholder via
+// Component::renderLazy and defer the real render()/data load until the
+// shared IntersectionObserver reports the placeholder near the viewport.
+// Visible work is drained by priority, a few hydrations per frame, so
+// the payments table comes up before footer charts even when both
+// scroll in together.
+
+enum class HydrationPriority : uint8_t {
+    Critical = 0,  // above-the-fold essentials (payments table)
+    High,
+    Normal,
+    Low            // footer charts, rarely-seen widgets
+};
+
+class HydrationScheduler {
+private:
+    struct Pending {
+        HydrationPriority priority = HydrationPriority::Normal;
+        std::function<void()> hydrate;
+    };
+
+    // Observed but not yet near the viewport
+    std::unordered_map<std::string, Pending> pending;
+    // Near the viewport, waiting for frame budget; kept priority-sorted
+    std::vector<std::pair<std::string, Pending>> ready;
+    bool drain_scheduled = false;
+
+    HydrationScheduler() = default;
+
+public:
+    static HydrationScheduler& instance();
+
+    // Register a placeholder element (by id) with the shared observer;
+    // `hydrate` runs on the main thread once the element is near the
+    // viewport and its turn in the priority queue comes up
+    void observe(const std::string& target, HydrationPriority priority,
+                 std::function<void()> hydrate);
+
+    // Forget a target whose component went away before hydrating
+    void unobserve(const std::string& target);
+
+    // Entry point from the JS observer callback
+    void onIntersect(const std::string& target);
+
+    size_t pendingCount() const { return pending.size() + ready.size(); }
+
+    // Hydrate up to the per-frame budget, highest priority first; called
+    // from the animation-frame callback
+    void drain();
+
+private:
+    void scheduleDrain();
+};
+
+} // namespace Defiant
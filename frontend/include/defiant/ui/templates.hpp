@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <emscripten/val.h>
+
+namespace Defiant {
+namespace Templates {
+
+// Compile-time HTML template facility. A component's static structure is
+// concatenated into a single string at build time; render() instantiates
+// it with one innerHTML assignment and then binds only the dynamic slots
+// (marked with data-slot attributes), instead of issuing a
+// createElement/setAttribute/appendChild call per node.
+
+template <size_t N>
+struct FixedString {
+    char data[N] = {};
+
+    constexpr FixedString() = default;
+
+    constexpr FixedString(const char (&s)[N]) {
+        for (size_t i = 0; i < N; ++i) {
+            data[i] = s[i];
+        }
+    }
+
+    static constexpr size_t length = N - 1;
+
+    constexpr std::string_view view() const { return {data, N - 1}; }
+    constexpr const char* c_str() const { return data; }
+};
+
+// Concatenate string literals into one NUL-terminated FixedString at
+// compile time
+template <size_t... Ns>
+constexpr auto concat(const char (&...parts)[Ns]) {
+    FixedString<(1 + ... + (Ns - 1))> out{};
+    size_t pos = 0;
+    auto append = [&](const char* s, size_t len) {
+        for (size_t i = 0; i < len; ++i) {
+            out.data[pos++] = s[i];
+        }
+    };
+    (append(parts, Ns - 1), ...);
+    out.data[pos] = '\0';
+    return out;
+}
+
+// Resolve a dynamic slot inside an instantiated template
+inline emscripten::val slot(emscripten::val root, const char* name) {
+    std::string selector = "[data-slot=\"";
+    selector += name;
+    selector += "\"]";
+    return root.call<emscripten::val>("querySelector", emscripten::val(selector));
+}
+
+} // namespace Templates
+} // namespace Defiant
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace Defiant {
+
+// Interned DOM token. Class names and style property names that churn on
+// hot update paths (Button variant/size classes, animated style
+// properties) are registered with the JS side once and referenced as
+// small integers afterwards: no C++ string is constructed per call and
+// the per-frame ops payload carries an int where it used to carry the
+// class name. Token 0 is reserved for "no token".
+using DomToken = uint16_t;
+
+class DomTokenTable {
+private:
+    std::unordered_map<std::string, DomToken> tokens;
+    // Registered but not yet shipped to JS; drained by the batch flush
+    std::vector<std::pair<DomToken, std::string>> pending;
+
+    DomTokenTable() = default;
+
+public:
+    static DomTokenTable& instance();
+
+    // Idempotent. The string crosses the boundary once, riding the next
+    // batch flush, and never again.
+    DomToken intern(const std::string& name);
+
+    bool hasPending() const { return !pending.empty(); }
+    std::vector<std::pair<DomToken, std::string>> takePending();
+};
+
+// A single recorded DOM mutation. Mutations reference their target element
+// by component id so the flush can resolve them entirely on the JS side.
+struct DomMutation {
+    enum class Type : uint8_t {
+        SetStyle,
+        AddClass,
+        RemoveClass,
+        SetAttribute,
+        RemoveAttribute,
+        SetInnerHTML,
+        SetProperty
+    };
+
+    Type type;
+    std::string target;  // element id
+    std::string name;    // style property / class / attribute name
+    std::string value;   // new value (unused for class and remove ops)
+    DomToken name_token = 0;  // when nonzero, `name` is empty and the JS
+                              // side resolves the token instead
+};
+
+// Retained mutation buffer that batches DOM writes from the component tree.
+//
+// Every Component::setStyle/addClass/setAttribute/setInnerHTML records into
+// this buffer instead of issuing an individual emscripten::val call. The
+// buffer deduplicates writes to the same (element, property) slot within a
+// frame and flushes everything to the real DOM once per animation frame
+// through a single JS call, so a Button::update() costs one boundary
+// crossing instead of a dozen.
+class DomBatch {
+private:
+    std::vector<DomMutation> mutations;
+    // Maps "target\x1fname" -> index into mutations, for last-write-wins
+    // coalescing of style/attribute/innerHTML writes within a frame.
+    std::unordered_map<std::string, size_t> write_slots;
+    bool flush_scheduled = false;
+    bool enabled = true;
+
+    DomBatch() = default;
+
+public:
+    static DomBatch& instance();
+
+    // Record a mutation. Schedules a flush on the next animation frame if
+    // one is not already pending.
+    void queue(DomMutation::Type type,
+               const std::string& target,
+               const std::string& name,
+               const std::string& value = "");
+
+    // Tokenized variant for pre-interned class/style names; the hot path
+    // never touches the name string
+    void queueToken(DomMutation::Type type,
+                    const std::string& target,
+                    DomToken name_token,
+                    const std::string& value = "");
+
+    // Apply all pending mutations to the real DOM in one boundary crossing.
+    // Called from the animation-frame callback; safe to call manually when
+    // a synchronous DOM state is required (e.g. before reading layout).
+    void flush();
+
+    // Escape hatch for code that must write through immediately: while
+    // disabled, queue()/queueToken() apply each mutation on the spot
+    // instead of buffering it.
+    void setEnabled(bool on);
+    bool isEnabled() const { return enabled; }
+
+    size_t pendingCount() const { return mutations.size(); }
+
+private:
+    void scheduleFlush();
+    // Single-mutation write-through for the disabled state
+    void applyImmediate(const DomMutation& m);
+};
+
+} // namespace Defiant
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Defiant {
+
+// Currency formatting.
+//
+// The payments table formats every visible amount on every refresh, so
+// this path is deliberately table-driven: currencies resolve once into a
+// static descriptor (symbol, minor-unit digits), digits are emitted two
+// at a time from a pair lookup table into a stack buffer, and a small
+// direct-mapped cache short-circuits the handful of price points that
+// dominate real data. No locale machinery, no stringstream.
+
+struct CurrencyDesc {
+    const char* code;
+    const char* symbol;
+    uint8_t decimals;       // minor units per major (2 for USD, 0 for JPY)
+    uint8_t symbol_length;  // strlen(symbol), precomputed
+};
+
+class FormatUtils {
+public:
+    // Upper bound on a formatted amount: symbol + sign + grouped int64
+    // digits + decimal point. Buffers passed to formatCurrencyTo must be
+    // at least this large.
+    static constexpr size_t kMaxFormatted = 40;
+
+    // Descriptor for an ISO code, or the generic fallback (code used as
+    // prefix, two decimals) when the currency is not in the table
+    static const CurrencyDesc& currencyDesc(std::string_view currency);
+
+    // Writes "$1,234.56" style output into buf and returns the length.
+    // Allocation-free; this is the per-cell fast path.
+    static size_t formatCurrencyTo(int64_t amount, const CurrencyDesc& desc,
+                                   char* buf);
+
+    // Convenience wrapper returning a string, memoized on (amount,
+    // currency) because table refreshes re-format the same few values
+    static std::string formatCurrency(int64_t amount,
+                                      const std::string& currency);
+};
+
+} // namespace Defiant
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Defiant {
+
+// Compiled field validation.
+//
+// Input::validate used to do ad-hoc find()/compare scanning and
+// reallocate the error string on every keystroke. Rules are now compiled
+// once per field into a compact bytecode program — charset bitmaps,
+// length ranges, Luhn, expiry shape, IBAN mod-97 — that runs as a single
+// allocation-free pass over the value. Each instruction carries a static
+// error string, so a failing keystroke returns a pointer, not a string.
+
+enum class VOp : uint8_t {
+    Charset,      // every char present in charsets[a]
+    LengthRange,  // a <= size <= b
+    DigitCount,   // a <= number of digit chars <= b (spaces etc. ignored)
+    Luhn,         // digits (spaces skipped) pass the Luhn checksum
+    Expiry,       // MM/YY or MM/YYYY with a valid month
+    EmailShape,   // local@domain.tld, one '@', dot in the domain
+    IbanCheck     // two-letter country code + mod-97 == 1
+};
+
+struct VInstr {
+    VOp op;
+    uint16_t a = 0;
+    uint16_t b = 0;
+    const char* error = nullptr;  // static string returned on failure
+};
+
+class CompiledValidator {
+private:
+    std::vector<VInstr> program;
+    // 256-bit membership bitmaps referenced by Charset instructions
+    std::vector<std::array<uint64_t, 4>> charsets;
+
+public:
+    // Owns the program parts directly (CompiledValidator is incomplete
+    // here, so it cannot be a data member) and assembles the validator
+    // in compile()
+    class Builder {
+    private:
+        std::vector<VInstr> program;
+        std::vector<std::array<uint64_t, 4>> charsets;
+
+    public:
+        Builder& charset(const char* allowed, const char* error);
+        Builder& lengthRange(uint16_t min, uint16_t max, const char* error);
+        Builder& digitCount(uint16_t min, uint16_t max, const char* error);
+        Builder& luhn(const char* error);
+        Builder& expiry(const char* error);
+        Builder& emailShape(const char* error);
+        Builder& iban(const char* error);
+
+        CompiledValidator compile() {
+            CompiledValidator v;
+            v.program = std::move(program);
+            v.charsets = std::move(charsets);
+            return v;
+        }
+    };
+
+    // Run the program over a value. Returns nullptr when every
+    // instruction passes, otherwise the failing instruction's error.
+    // No allocation, single pass per instruction.
+    const char* run(std::string_view value) const;
+
+    // Prebuilt programs for the checkout fields, compiled on first use
+    static const CompiledValidator& email();
+    static const CompiledValidator& cardNumber();
+    static const CompiledValidator& expiryDate();
+    static const CompiledValidator& cvc();
+    static const CompiledValidator& iban();
+
+    // Program for an Input `type` attribute, nullptr when the type has
+    // no rules ("text", "password", ...)
+    static const CompiledValidator* forInputType(std::string_view type);
+};
+
+} // namespace Defiant
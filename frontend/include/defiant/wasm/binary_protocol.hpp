@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+#include "defiant/core/event_bus.hpp"
+
+namespace Defiant {
+
+// Binary WebSocket wire format (negotiated with ?format=binary at connect
+// time; old servers keep sending JSON text and are detected by the first
+// byte). All integers are little-endian. Strings are length-prefixed and
+// parsed as views into the received buffer — no copies, no JSON parse.
+//
+//   offset 0: uint8  magic        (0xDF)
+//   offset 1: uint8  version      (kBinaryProtocolVersion)
+//   offset 2: uint8  event_type   (EventType wire id)
+//   offset 3: uint8  status       (PaymentStatus wire id)
+//   offset 4: int64  amount       (minor units)
+//   offset 12: uint16 id_len,       followed by id bytes
+//   ...:       uint16 currency_len, followed by currency bytes
+//
+constexpr uint8_t kBinaryFrameMagic = 0xDF;
+constexpr uint8_t kBinaryProtocolVersion = 1;
+
+// Small-int payment status codes shared with the backend
+enum class PaymentStatus : uint8_t {
+    Pending,
+    Processing,
+    Succeeded,
+    Failed,
+    Refunded,
+    Canceled,
+
+    Unknown // keep last
+};
+
+const char* paymentStatusName(PaymentStatus status);
+PaymentStatus paymentStatusFromName(std::string_view name);
+
+// Zero-copy payment payload: views point into the WebSocket message buffer
+// and are only valid for the duration of the dispatch.
+struct PaymentEventView {
+    std::string_view id;
+    int64_t amount = 0;
+    std::string_view currency;
+    PaymentStatus status = PaymentStatus::Unknown;
+
+    nlohmann::json toJson() const;
+};
+
+struct BinaryFrame {
+    EventType type = EventType::Count;
+    PaymentEventView payment;
+};
+
+// Cursor over a received frame. Readers bounds-check and never copy.
+class BinaryFrameReader {
+private:
+    const uint8_t* data;
+    size_t length;
+    size_t offset = 0;
+    bool failed = false;
+
+public:
+    BinaryFrameReader(const uint8_t* data, size_t length)
+        : data(data), length(length) {}
+
+    uint8_t readU8();
+    uint16_t readU16();
+    uint32_t readU32();
+    int64_t readI64();
+    std::string_view readString16();
+
+    bool ok() const { return !failed; }
+    size_t remaining() const { return length - offset; }
+};
+
+// Parse a binary frame in place. Returns false (leaving frame untouched)
+// when the buffer is not a valid frame of a supported version.
+bool parseBinaryFrame(const uint8_t* data, size_t length, BinaryFrame& frame);
+
+// Cheap dispatch test: does this message look like a binary frame rather
+// than JSON text?
+inline bool isBinaryFrame(const uint8_t* data, size_t length) {
+    return length >= 2 && data[0] == kBinaryFrameMagic &&
+           data[1] == kBinaryProtocolVersion;
+}
+
+} // namespace Defiant
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace Defiant {
+
+// Final, upload-ready geometry for one chart series. Vertices are
+// interleaved (x, y) pairs with x normalized to [0, 1] and y left in data
+// space; min/max give the renderer its y-axis range without another pass.
+struct ChartVertexBuffer {
+    std::vector<float> vertices;
+    double min_value = 0.0;
+    double max_value = 0.0;
+    size_t source_points = 0;
+};
+
+// Worker-thread compute pipeline for chart data preparation.
+//
+// The build already ships a 4-thread pthread pool; this runs the
+// binning/downsampling/min-max aggregation there and posts only the final
+// vertex buffer back to the main thread, where the callback performs the
+// WebGL upload. A month of payments no longer freezes input handling
+// while it is being aggregated.
+class ChartWorkerPool {
+private:
+    ChartWorkerPool();
+
+public:
+    static ChartWorkerPool& instance();
+
+    // Invoked on the main thread with the finished buffer
+    using ResultCallback = std::function<void(ChartVertexBuffer)>;
+
+    // Downsample `values` to at most `target_points` bins using min-max
+    // envelope preservation and deliver the vertex buffer asynchronously.
+    void prepare(std::vector<double> values,
+                 size_t target_points,
+                 ResultCallback callback);
+
+    // The aggregation kernel itself; exposed for the synchronous fallback
+    // in single-threaded builds (and for benchmarking).
+    static ChartVertexBuffer downsample(const std::vector<double>& values,
+                                        size_t target_points);
+};
+
+} // namespace Defiant
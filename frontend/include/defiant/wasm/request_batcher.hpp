@@ -0,0 +1,83 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace Defiant {
+
+// Outcome of one sub-request inside a multiplexed batch
+struct BatchResult {
+    int status = 0;
+    nlohmann::json body;
+
+    bool ok() const { return status >= 200 && status < 300; }
+};
+
+// Futures-style handle for a batched request. Callbacks registered with
+// then() run on the main thread when the batch response arrives; if the
+// result is already in, they run immediately.
+class BatchFuture {
+private:
+    struct State {
+        bool ready = false;
+        BatchResult result;
+        std::vector<std::function<void(const BatchResult&)>> callbacks;
+    };
+
+    std::shared_ptr<State> state;
+
+    friend class RequestBatcher;
+    void resolve(BatchResult result);
+
+public:
+    BatchFuture() : state(std::make_shared<State>()) {}
+
+    void then(std::function<void(const BatchResult&)> callback);
+    bool ready() const { return state->ready; }
+    const BatchResult& result() const { return state->result; }
+};
+
+// Coalesces API requests issued within the same tick into one multiplexed
+// HTTP call against the backend batch endpoint (POST /v1/batch).
+//
+// The first request() arms a zero-delay flush on the event loop; everything
+// queued before the tick ends ships as a single fetch, so the init cascade
+// (api state + dashboard pages + per-row customer lookups) pays one network
+// round trip instead of one per request. Callers hold BatchFutures and can
+// issue all their queries concurrently instead of sequentially.
+class RequestBatcher {
+private:
+    struct PendingRequest {
+        std::string method;
+        std::string path;
+        nlohmann::json body;
+        BatchFuture future;
+    };
+
+    std::string base_url;
+    std::string api_key;
+    std::vector<PendingRequest> pending;
+    bool flush_scheduled = false;
+
+public:
+    RequestBatcher(std::string base_url, std::string api_key);
+
+    // Queue a request into the current tick's batch
+    BatchFuture request(const std::string& method,
+                        const std::string& path,
+                        const nlohmann::json& body = nlohmann::json());
+
+    // Send the current batch immediately instead of at end of tick
+    void flush();
+
+    size_t pendingCount() const { return pending.size(); }
+
+private:
+    void scheduleFlush();
+    static void onFlushTick(void* user_data);
+};
+
+} // namespace Defiant
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+namespace Defiant {
+
+// Shared-memory ring transport between the pthread pool and the main
+// thread.
+//
+// With USE_PTHREADS the WASM heap is one SharedArrayBuffer, so anything
+// a worker writes is already visible to the main thread — the only thing
+// missing is a safe handoff. This is that handoff: a bounded lock-free
+// MPSC ring (Vyukov-style sequence-stamped slots) where workers publish
+// results into preallocated slots and the main thread consumes them in
+// place during the rAF tick. No postMessage, no structured clone, no
+// per-message allocation for small payloads.
+
+// Well-known message tags; subsystems may also use their own values
+// above kFirstUserTag
+enum class RingMessage : uint32_t {
+    ChartVertices = 1,   // Delivery pointer from the chart worker pool
+    SerializedState = 2, // state blob prepared off-thread
+    ParsedPayments = 3,  // WebSocket batch decoded off-thread
+};
+constexpr uint32_t kFirstUserTag = 64;
+
+class MpscRing {
+public:
+    // Payloads up to this size live inline in the slot; larger ones are
+    // carried as an adopted heap block (still shared memory, no copy on
+    // the consume side)
+    static constexpr size_t kInlinePayload = 248;
+
+    explicit MpscRing(size_t capacity);  // rounded up to a power of two
+    ~MpscRing();
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    // Producer side (any thread). Copies `size` bytes into the slot;
+    // returns false when the ring is full and the message was dropped.
+    bool tryPublish(uint32_t tag, const void* data, size_t size);
+
+    // Producer side for large payloads: the ring adopts `block`
+    // (new[]-allocated) and frees it after the consumer has run. On a
+    // full ring the block is freed and false returned.
+    bool tryPublishOwned(uint32_t tag, uint8_t* block, size_t size);
+
+    // Consumer side (main thread only). Invokes fn(tag, payload, size)
+    // for up to max_messages ready slots; the payload pointer is valid
+    // only for the duration of the call. Returns the number consumed.
+    using MessageFn =
+        std::function<void(uint32_t, const uint8_t*, size_t)>;
+    size_t drain(const MessageFn& fn, size_t max_messages);
+
+    size_t capacity() const { return capacity_; }
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> sequence;
+        uint32_t tag = 0;
+        uint32_t size = 0;
+        uint8_t* spill = nullptr;
+        alignas(8) uint8_t inline_payload[kInlinePayload];
+    };
+
+    Slot* claimSlot(uint64_t& pos);
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t capacity_;
+    size_t mask_;
+    alignas(64) std::atomic<uint64_t> enqueue_pos_{0};
+    alignas(64) uint64_t dequeue_pos_ = 0;  // main thread only
+};
+
+// The process-wide transport: one ring plus a tag -> handler table.
+// Workers publish; DefiantApp's animation frame tick calls drain(), so
+// results land on the main thread at most one frame after they are
+// produced, batched with that frame's other work.
+class WorkerTransport {
+private:
+    WorkerTransport();
+
+public:
+    static WorkerTransport& instance();
+
+    using Handler = std::function<void(const uint8_t*, size_t)>;
+
+    // Main thread: route messages with this tag to `handler`.
+    // Re-registering a tag replaces the previous handler.
+    void onMessage(uint32_t tag, Handler handler);
+    void onMessage(RingMessage tag, Handler handler) {
+        onMessage(static_cast<uint32_t>(tag), std::move(handler));
+    }
+
+    // Producer side, callable from any pool thread
+    bool publish(uint32_t tag, const void* data, size_t size);
+    bool publish(RingMessage tag, const void* data, size_t size) {
+        return publish(static_cast<uint32_t>(tag), data, size);
+    }
+    bool publishOwned(uint32_t tag, uint8_t* block, size_t size);
+
+    // Main thread pump; messages without a handler are dropped
+    size_t drain(size_t max_messages);
+
+private:
+    MpscRing ring_;
+    std::unordered_map<uint32_t, Handler> handlers_;
+};
+
+} // namespace Defiant
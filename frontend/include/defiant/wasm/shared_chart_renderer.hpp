@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <emscripten/html5.h>
+#include <GLES3/gl3.h>
+
+#include "defiant/wasm/chart_worker.hpp"
+
+namespace Defiant {
+
+// Shared-renderer mode for charts: every Chart registers here instead of
+// owning its own WebGLRenderer, so a dashboard with eight charts holds one
+// GL context instead of eight. Geometry for all charts is concatenated
+// into one shared vertex buffer (uploaded at most once per frame) and all
+// charts render in a single pass with scissor rects — O(1) buffer binds
+// and one draw call per chart range.
+class SharedChartRenderer {
+private:
+    struct Slot {
+        bool in_use = false;
+        std::string chart_id;
+        // Staged geometry for this chart; concatenated into the shared
+        // buffer when it goes dirty
+        std::vector<float> vertices;
+        // Range into the shared vertex buffer, in floats
+        size_t first_float = 0;
+        size_t float_count = 0;
+        // Pixel rect on the shared canvas
+        int x = 0, y = 0, width = 0, height = 0;
+        // Data-space y range for the vertex transform
+        float min_value = 0.0f;
+        float max_value = 1.0f;
+        float color[4] = {0.39f, 0.40f, 0.95f, 1.0f}; // ColorScheme primary
+    };
+
+    EMSCRIPTEN_WEBGL_CONTEXT_HANDLE context = 0;
+    GLuint program = 0;
+    GLuint vbo = 0;
+    GLuint vao = 0;
+    GLint uniform_y_range = -1;
+    GLint uniform_color = -1;
+
+    std::vector<Slot> slots;
+    std::vector<float> vertex_data; // all charts, concatenated
+    bool buffer_dirty = false;
+    bool render_scheduled = false;
+
+    SharedChartRenderer() = default;
+
+public:
+    static SharedChartRenderer& instance();
+
+    // Create the single context on the shared canvas. Safe to call more
+    // than once; later calls are no-ops.
+    bool initialize(const char* canvas_selector = "#defiant-charts");
+
+    // Returns an opaque handle; -1 on failure
+    int registerChart(const std::string& chart_id);
+    void unregisterChart(int handle);
+
+    // Replace one chart's geometry and placement; marks the shared buffer
+    // dirty and schedules a batched render on the next animation frame
+    void updateGeometry(int handle,
+                        const ChartVertexBuffer& buffer,
+                        int x, int y, int width, int height);
+    void setColor(int handle, float r, float g, float b, float a = 1.0f);
+
+    // Upload the shared buffer if dirty and draw every registered chart in
+    // one pass
+    void renderAll();
+
+    size_t chartCount() const;
+
+private:
+    void scheduleRender();
+    void rebuildVertexData();
+    bool compileProgram();
+};
+
+} // namespace Defiant
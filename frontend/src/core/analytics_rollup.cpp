@@ -0,0 +1,74 @@
+#include "defiant/core/analytics_rollup.hpp"
+
+namespace Defiant {
+
+nlohmann::json AnalyticsSummary::toJson() const {
+    return {
+        {"total_amount", total_amount},
+        {"total_count", total_count},
+        {"successful_count", successful_count},
+        {"failed_count", failed_count},
+        {"refunded_amount", refunded_amount},
+        {"start_date", start_date},
+        {"end_date", end_date}
+    };
+}
+
+void AnalyticsRollup::seed(const nlohmann::json& snapshot) {
+    summary.total_amount = snapshot.value("total_amount", int64_t{0});
+    summary.total_count = snapshot.value("total_count", int64_t{0});
+    summary.successful_count = snapshot.value("successful_count", int64_t{0});
+    summary.failed_count = snapshot.value("failed_count", int64_t{0});
+    summary.refunded_amount = snapshot.value("refunded_amount", int64_t{0});
+    summary.start_date = snapshot.value("start_date", "");
+    summary.end_date = snapshot.value("end_date", "");
+    seeded = true;
+    ++revision;
+}
+
+void AnalyticsRollup::applyPaymentDelta(EventType type,
+                                        std::string_view payment_id,
+                                        int64_t amount,
+                                        std::string_view status) {
+    bool is_new = type == EventType::PaymentCreated ||
+                  type == EventType::WebSocketPaymentCreated;
+
+    if (is_new && !payment_id.empty() &&
+        !counted_payments.insert(std::string(payment_id)).second) {
+        // WebSocket echo of a payment this client created (or vice
+        // versa): the whole delta, terminal status included, already
+        // landed with the first event
+        return;
+    }
+
+    if (is_new) {
+        ++summary.total_count;
+        summary.total_amount += amount;
+    }
+
+    // Terminal statuses adjust the outcome counters; a payment created
+    // already-succeeded (card capture) and one that transitions later
+    // both land here exactly once because the server emits one terminal
+    // event per payment
+    if (status == "succeeded") {
+        ++summary.successful_count;
+    } else if (status == "failed") {
+        ++summary.failed_count;
+    }
+
+    ++revision;
+}
+
+void AnalyticsRollup::applyRefundDelta(int64_t amount) {
+    summary.refunded_amount += amount;
+    ++revision;
+}
+
+void AnalyticsRollup::reset() {
+    summary = AnalyticsSummary{};
+    seeded = false;
+    counted_payments.clear();
+    ++revision;
+}
+
+} // namespace Defiant
@@ -0,0 +1,100 @@
+#include "defiant/core/arena.hpp"
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+namespace Defiant {
+
+Arena::Arena(size_t blockSize) : block_size(blockSize) {
+    grow(block_size);
+}
+
+void* Arena::allocate(size_t size, size_t alignment) {
+    Block* block = &blocks[current_block];
+
+    while (true) {
+        uintptr_t base = reinterpret_cast<uintptr_t>(block->data.get()) + block->used;
+        uintptr_t aligned = (base + alignment - 1) & ~(alignment - 1);
+        size_t padding = aligned - base;
+
+        if (block->used + padding + size <= block->size) {
+            block->used += padding + size;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        // Current block exhausted: move to the next one, growing if needed
+        if (current_block + 1 < blocks.size()) {
+            ++current_block;
+            block = &blocks[current_block];
+        } else {
+            block = &grow(size + alignment);
+            current_block = blocks.size() - 1;
+        }
+    }
+}
+
+void Arena::reset() {
+    for (auto& block : blocks) {
+        block.used = 0;
+    }
+    current_block = 0;
+}
+
+size_t Arena::bytesUsed() const {
+    size_t total = 0;
+    for (const auto& block : blocks) {
+        total += block.used;
+    }
+    return total;
+}
+
+size_t Arena::bytesReserved() const {
+    size_t total = 0;
+    for (const auto& block : blocks) {
+        total += block.size;
+    }
+    return total;
+}
+
+Arena::Block& Arena::grow(size_t minimum) {
+    size_t size = std::max(block_size, minimum);
+    blocks.push_back({std::unique_ptr<char[]>(new char[size]), size, 0});
+    return blocks.back();
+}
+
+Arena& ComponentArena::get() {
+    static Arena arena(256 * 1024);
+    return arena;
+}
+
+Arena& FrameArena::get() {
+    static Arena arena(32 * 1024);
+    return arena;
+}
+
+void FrameArena::reset() {
+    get().reset();
+}
+
+const char* FrameArena::format(const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    va_list args_copy;
+    va_copy(args_copy, args);
+
+    int needed = vsnprintf(nullptr, 0, fmt, args);
+    va_end(args);
+
+    if (needed < 0) {
+        va_end(args_copy);
+        return "";
+    }
+
+    char* buffer = static_cast<char*>(get().allocate(needed + 1, 1));
+    vsnprintf(buffer, needed + 1, fmt, args_copy);
+    va_end(args_copy);
+    return buffer;
+}
+
+} // namespace Defiant
@@ -0,0 +1,108 @@
+#include "defiant/core/event_bus.hpp"
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten/val.h>
+#endif
+
+namespace Defiant {
+
+namespace {
+
+constexpr const char* kEventNames[] = {
+    "app.initialized",
+    "payment.creating",
+    "payment.created",
+    "payment.refunding",
+    "payment.refunded",
+    "payment_form.rendered",
+    "dashboard.rendered",
+    "websocket.payment.created",
+    "websocket.payment.updated",
+    "websocket.invoice.paid",
+    "websocket.customer.updated",
+    "websocket.error",
+};
+
+static_assert(sizeof(kEventNames) / sizeof(kEventNames[0]) ==
+                  static_cast<size_t>(EventType::Count),
+              "kEventNames must cover every EventType");
+
+} // namespace
+
+const char* eventTypeName(EventType type) {
+    return kEventNames[static_cast<size_t>(type)];
+}
+
+EventType eventTypeFromName(std::string_view name) {
+    for (size_t i = 0; i < static_cast<size_t>(EventType::Count); ++i) {
+        if (name == kEventNames[i]) {
+            return static_cast<EventType>(i);
+        }
+    }
+    return EventType::Count;
+}
+
+nlohmann::json PaymentEvent::toJson() const {
+    return {
+        {"id", id},
+        {"amount", amount},
+        {"currency", currency},
+        {"status", status}
+    };
+}
+
+nlohmann::json RefundEvent::toJson() const {
+    return {
+        {"payment_id", payment_id},
+        {"amount", amount}
+    };
+}
+
+nlohmann::json ErrorEvent::toJson() const {
+    return {{"error", message}};
+}
+
+nlohmann::json LifecycleEvent::toJson() const {
+    nlohmann::json data = {{"timestamp", timestamp}};
+    if (!detail.empty()) {
+        data["detail"] = detail;
+    }
+    return data;
+}
+
+void EventBus::subscribeRaw(EventType type, RawCallback callback) {
+    listeners[index(type)].push_back(std::move(callback));
+}
+
+void EventBus::enableJsDispatch(EventType type, bool enabled) {
+    js_dispatch[index(type)] = enabled;
+}
+
+bool EventBus::jsDispatchEnabled(EventType type) const {
+    return js_dispatch[index(type)];
+}
+
+size_t EventBus::listenerCount(EventType type) const {
+    return listeners[index(type)].size();
+}
+
+void EventBus::dispatchToJs(EventType type, const nlohmann::json& data) {
+#ifdef __EMSCRIPTEN__
+    try {
+        emscripten::val::global("window").call<void>("dispatchEvent",
+            emscripten::val::global("CustomEvent").new_(
+                emscripten::val(eventTypeName(type)),
+                emscripten::val::object().set("detail", emscripten::val(data.dump()))
+            )
+        );
+    } catch (...) {
+        // Silently fail if window is not available
+    }
+#else
+    // Native builds (the benchmark target) have no page to notify
+    (void)type;
+    (void)data;
+#endif
+}
+
+} // namespace Defiant
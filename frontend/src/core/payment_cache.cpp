@@ -0,0 +1,54 @@
+#include "defiant/core/payment_cache.hpp"
+
+namespace Defiant {
+
+std::string PaymentPageCache::normalizeKey(const PaymentListQuery& query) {
+    std::string key;
+    key.reserve(64);
+    key += "cursor=";
+    key += query.cursor;
+    key += "&limit=";
+    key += std::to_string(query.limit);
+    key += "&status=";
+    key += query.status;
+    key += "&customer=";
+    key += query.customer_id;
+    return key;
+}
+
+const std::vector<Payment>* PaymentPageCache::get(const std::string& key) {
+    auto it = index.find(key);
+    if (it == index.end()) {
+        ++miss_count;
+        return nullptr;
+    }
+
+    ++hit_count;
+    // Move to front (most recently used)
+    lru.splice(lru.begin(), lru, it->second);
+    return &it->second->payments;
+}
+
+void PaymentPageCache::put(const std::string& key, std::vector<Payment> payments) {
+    auto it = index.find(key);
+    if (it != index.end()) {
+        it->second->payments = std::move(payments);
+        lru.splice(lru.begin(), lru, it->second);
+        return;
+    }
+
+    lru.push_front({key, std::move(payments)});
+    index.emplace(key, lru.begin());
+
+    if (lru.size() > capacity) {
+        index.erase(lru.back().key);
+        lru.pop_back();
+    }
+}
+
+void PaymentPageCache::invalidate() {
+    lru.clear();
+    index.clear();
+}
+
+} // namespace Defiant
@@ -0,0 +1,124 @@
+#include "defiant/core/payment_store.hpp"
+#include <algorithm>
+#include <numeric>
+
+namespace Defiant {
+
+void PaymentStore::assign(const std::vector<Payment>& payments) {
+    clear();
+
+    ids_.reserve(payments.size());
+    amounts_.reserve(payments.size());
+    statuses_.reserve(payments.size());
+    currencies_.reserve(payments.size());
+
+    for (const auto& payment : payments) {
+        ids_.push_back(payment.id);
+        amounts_.push_back(payment.amount);
+        statuses_.push_back(paymentStatusFromName(payment.status));
+        currencies_.push_back(internCurrency(payment.currency));
+    }
+}
+
+void PaymentStore::clear() {
+    ids_.clear();
+    amounts_.clear();
+    statuses_.clear();
+    currencies_.clear();
+    // Keep the interning table: the same few currencies recur across
+    // result sets and tokens stay stable
+}
+
+uint16_t PaymentStore::internCurrency(const std::string& currency) {
+    auto it = currency_index_.find(currency);
+    if (it != currency_index_.end()) {
+        return it->second;
+    }
+    uint16_t token = static_cast<uint16_t>(currency_names_.size());
+    currency_names_.push_back(currency);
+    currency_index_.emplace(currency, token);
+    return token;
+}
+
+void PaymentStore::sortByAmount(bool ascending, std::vector<uint32_t>& order) const {
+    order.resize(amounts_.size());
+    std::iota(order.begin(), order.end(), 0u);
+
+    const int64_t* amounts = amounts_.data();
+    if (ascending) {
+        std::sort(order.begin(), order.end(),
+                  [amounts](uint32_t a, uint32_t b) { return amounts[a] < amounts[b]; });
+    } else {
+        std::sort(order.begin(), order.end(),
+                  [amounts](uint32_t a, uint32_t b) { return amounts[a] > amounts[b]; });
+    }
+}
+
+void PaymentStore::sortByStatus(bool ascending, std::vector<uint32_t>& order) const {
+    order.resize(statuses_.size());
+    std::iota(order.begin(), order.end(), 0u);
+
+    const PaymentStatus* statuses = statuses_.data();
+    if (ascending) {
+        std::sort(order.begin(), order.end(),
+                  [statuses](uint32_t a, uint32_t b) { return statuses[a] < statuses[b]; });
+    } else {
+        std::sort(order.begin(), order.end(),
+                  [statuses](uint32_t a, uint32_t b) { return statuses[a] > statuses[b]; });
+    }
+}
+
+int64_t PaymentStore::totalAmount() const {
+    return std::accumulate(amounts_.begin(), amounts_.end(), int64_t{0});
+}
+
+int64_t PaymentStore::minAmount() const {
+    if (amounts_.empty()) {
+        return 0;
+    }
+    return *std::min_element(amounts_.begin(), amounts_.end());
+}
+
+int64_t PaymentStore::maxAmount() const {
+    if (amounts_.empty()) {
+        return 0;
+    }
+    return *std::max_element(amounts_.begin(), amounts_.end());
+}
+
+std::vector<std::vector<std::string>> PaymentStore::pageRows(
+    size_t offset, size_t limit, const std::vector<uint32_t>* order) const {
+    std::vector<std::vector<std::string>> rows;
+    size_t end = std::min(offset + limit, size());
+    if (offset >= end) {
+        return rows;
+    }
+
+    rows.reserve(end - offset);
+    for (size_t i = offset; i < end; ++i) {
+        size_t row = order ? (*order)[i] : i;
+        rows.push_back({
+            ids_[row],
+            std::to_string(amounts_[row]),
+            currency_names_[currencies_[row]],
+            paymentStatusName(statuses_[row])
+        });
+    }
+    return rows;
+}
+
+std::vector<Payment> PaymentStore::materialize() const {
+    std::vector<Payment> payments;
+    payments.reserve(size());
+    for (size_t row = 0; row < size(); ++row) {
+        Payment payment;
+        payment.id = ids_[row];
+        payment.amount = amounts_[row];
+        payment.currency = currency_names_[currencies_[row]];
+        payment.status = paymentStatusName(statuses_[row]);
+        payments.push_back(std::move(payment));
+    }
+    return payments;
+}
+
+} // namespace Defiant
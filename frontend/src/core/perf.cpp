@@ -0,0 +1,107 @@
+#include "defiant/core/perf.hpp"
+
+#include <emscripten/html5.h>
+
+namespace Defiant {
+
+Perf& Perf::instance() {
+    static Perf perf;
+    return perf;
+}
+
+void Perf::frameBoundary(double now_ms) {
+    if (!enabled) {
+        return;
+    }
+
+    if (frame_start_ms > 0.0) {
+        current_frame.total_ms = now_ms - frame_start_ms;
+        frames[frame_head] = current_frame;
+        frame_head = (frame_head + 1) % kFrameHistory;
+        if (frame_count < kFrameHistory) {
+            ++frame_count;
+        }
+    }
+
+    current_frame = FrameSample{};
+    frame_start_ms = now_ms;
+}
+
+void Perf::recordScope(const char* name, double elapsed_ms) {
+    if (!enabled) {
+        return;
+    }
+
+    ScopeStats& stats = scopes[name];
+    ++stats.calls;
+    stats.total_ms += elapsed_ms;
+    if (elapsed_ms > stats.max_ms) {
+        stats.max_ms = elapsed_ms;
+    }
+}
+
+void Perf::recordBoundaryCall(size_t bytes) {
+    if (!enabled) {
+        return;
+    }
+
+    ++current_frame.boundary_calls;
+    current_frame.boundary_bytes += bytes;
+    ++total_boundary_calls;
+    total_boundary_bytes += bytes;
+}
+
+nlohmann::json Perf::report() const {
+    nlohmann::json scope_list = nlohmann::json::array();
+    for (const auto& [name, stats] : scopes) {
+        scope_list.push_back({
+            {"name", name},
+            {"calls", stats.calls},
+            {"total_ms", stats.total_ms},
+            {"avg_ms", stats.calls ? stats.total_ms / stats.calls : 0.0},
+            {"max_ms", stats.max_ms}
+        });
+    }
+
+    nlohmann::json frame_list = nlohmann::json::array();
+    size_t start = (frame_head + kFrameHistory - frame_count) % kFrameHistory;
+    for (size_t i = 0; i < frame_count; ++i) {
+        const FrameSample& frame = frames[(start + i) % kFrameHistory];
+        frame_list.push_back({
+            {"total_ms", frame.total_ms},
+            {"boundary_calls", frame.boundary_calls},
+            {"boundary_bytes", frame.boundary_bytes}
+        });
+    }
+
+    return {
+        {"enabled", enabled},
+        {"scopes", std::move(scope_list)},
+        {"frames", std::move(frame_list)},
+        {"boundary_calls_total", total_boundary_calls},
+        {"boundary_bytes_total", total_boundary_bytes}
+    };
+}
+
+void Perf::reset() {
+    scopes.clear();
+    frame_head = 0;
+    frame_count = 0;
+    current_frame = FrameSample{};
+    frame_start_ms = 0.0;
+    total_boundary_calls = 0;
+    total_boundary_bytes = 0;
+}
+
+#if DEFIANT_PROFILING
+
+PerfScopedTimer::PerfScopedTimer(const char* name)
+    : name(name), start_ms(emscripten_get_now()) {}
+
+PerfScopedTimer::~PerfScopedTimer() {
+    Perf::instance().recordScope(name, emscripten_get_now() - start_ms);
+}
+
+#endif // DEFIANT_PROFILING
+
+} // namespace Defiant
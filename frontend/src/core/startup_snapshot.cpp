@@ -0,0 +1,194 @@
+#include "defiant/core/startup_snapshot.hpp"
+#include "defiant/wasm/binary_protocol.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include <emscripten.h>
+#include <emscripten/em_js.h>
+
+namespace Defiant {
+
+namespace {
+
+// Local-only blob: native (wasm little-endian) byte order, same
+// length-prefixed layout as the WebSocket frames
+constexpr uint8_t kSnapshotMagic = 0xDF;
+constexpr uint8_t kSnapshotTag = 0x53; // 'S'
+constexpr uint8_t kSnapshotVersion = 1;
+
+constexpr const char* kSnapshotDir = "/defiant_idbfs";
+constexpr const char* kSnapshotPath = "/defiant_idbfs/dashboard.snapshot";
+
+SnapshotStore::LoadCallback pending_load;
+
+void appendU8(std::vector<uint8_t>& out, uint8_t value) {
+    out.push_back(value);
+}
+
+void appendU16(std::vector<uint8_t>& out, uint16_t value) {
+    size_t at = out.size();
+    out.resize(at + 2);
+    std::memcpy(out.data() + at, &value, 2);
+}
+
+void appendU32(std::vector<uint8_t>& out, uint32_t value) {
+    size_t at = out.size();
+    out.resize(at + 4);
+    std::memcpy(out.data() + at, &value, 4);
+}
+
+void appendI64(std::vector<uint8_t>& out, int64_t value) {
+    size_t at = out.size();
+    out.resize(at + 8);
+    std::memcpy(out.data() + at, &value, 8);
+}
+
+void appendString16(std::vector<uint8_t>& out, const std::string& value) {
+    uint16_t len = value.size() > 0xFFFF
+                       ? uint16_t{0xFFFF}
+                       : static_cast<uint16_t>(value.size());
+    appendU16(out, len);
+    out.insert(out.end(), value.begin(), value.begin() + len);
+}
+
+} // namespace
+
+// Mount IDBFS once; the actual IndexedDB traffic happens in syncfs
+EM_JS(void, defiant_snapshot_mount, (), {
+    if (Module.defiantSnapshotMounted) return;
+    try { FS.mkdir('/defiant_idbfs'); } catch (e) {}
+    FS.mount(IDBFS, {}, '/defiant_idbfs');
+    Module.defiantSnapshotMounted = true;
+});
+
+// Pull IndexedDB into the in-memory FS, then hand control back to C++
+EM_JS(void, defiant_snapshot_sync_in, (), {
+    FS.syncfs(true, function(err) {
+        _defiant_snapshot_fs_synced(err ? 0 : 1);
+    });
+});
+
+// Push the in-memory FS out to IndexedDB; fire-and-forget
+EM_JS(void, defiant_snapshot_sync_out, (), {
+    FS.syncfs(false, function(err) {});
+});
+
+extern "C" EMSCRIPTEN_KEEPALIVE void defiant_snapshot_fs_synced(int ok) {
+    SnapshotStore::LoadCallback callback = std::move(pending_load);
+    pending_load = nullptr;
+    if (!callback) {
+        return;
+    }
+
+    StartupSnapshot snapshot;
+    if (!ok) {
+        callback(false, std::move(snapshot));
+        return;
+    }
+
+    std::FILE* file = std::fopen(kSnapshotPath, "rb");
+    if (!file) {
+        callback(false, std::move(snapshot));
+        return;
+    }
+
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+
+    std::vector<uint8_t> blob(size > 0 ? static_cast<size_t>(size) : 0);
+    bool read_ok = !blob.empty() &&
+                   std::fread(blob.data(), 1, blob.size(), file) == blob.size();
+    std::fclose(file);
+
+    bool decoded = read_ok &&
+                   SnapshotStore::decode(blob.data(), blob.size(), snapshot);
+    callback(decoded, std::move(snapshot));
+}
+
+void SnapshotStore::loadAsync(LoadCallback callback) {
+    pending_load = std::move(callback);
+    defiant_snapshot_mount();
+    defiant_snapshot_sync_in();
+}
+
+void SnapshotStore::save(const StartupSnapshot& snapshot) {
+    defiant_snapshot_mount();
+
+    std::vector<uint8_t> blob = encode(snapshot);
+    std::FILE* file = std::fopen(kSnapshotPath, "wb");
+    if (!file) {
+        return;
+    }
+    std::fwrite(blob.data(), 1, blob.size(), file);
+    std::fclose(file);
+
+    defiant_snapshot_sync_out();
+}
+
+std::vector<uint8_t> SnapshotStore::encode(const StartupSnapshot& snapshot) {
+    std::vector<uint8_t> out;
+    out.reserve(64 + snapshot.payments.size() * 48);
+
+    appendU8(out, kSnapshotMagic);
+    appendU8(out, kSnapshotTag);
+    appendU8(out, kSnapshotVersion);
+
+    appendI64(out, snapshot.analytics.total_amount);
+    appendI64(out, snapshot.analytics.total_count);
+    appendI64(out, snapshot.analytics.successful_count);
+    appendI64(out, snapshot.analytics.failed_count);
+    appendI64(out, snapshot.analytics.refunded_amount);
+    appendString16(out, snapshot.analytics.start_date);
+    appendString16(out, snapshot.analytics.end_date);
+
+    appendU32(out, static_cast<uint32_t>(snapshot.payments.size()));
+    for (const Payment& payment : snapshot.payments) {
+        appendString16(out, payment.id);
+        appendI64(out, payment.amount);
+        appendString16(out, payment.currency);
+        appendString16(out, payment.status);
+    }
+
+    return out;
+}
+
+bool SnapshotStore::decode(const uint8_t* data, size_t length,
+                           StartupSnapshot& out) {
+    BinaryFrameReader reader(data, length);
+
+    if (reader.readU8() != kSnapshotMagic || reader.readU8() != kSnapshotTag ||
+        reader.readU8() != kSnapshotVersion) {
+        return false;
+    }
+
+    out.analytics.total_amount = reader.readI64();
+    out.analytics.total_count = reader.readI64();
+    out.analytics.successful_count = reader.readI64();
+    out.analytics.failed_count = reader.readI64();
+    out.analytics.refunded_amount = reader.readI64();
+    out.analytics.start_date = std::string(reader.readString16());
+    out.analytics.end_date = std::string(reader.readString16());
+
+    uint32_t count = reader.readU32();
+    if (!reader.ok()) {
+        return false;
+    }
+
+    out.payments.clear();
+    out.payments.reserve(count);
+    for (uint32_t i = 0; i < count && reader.ok(); ++i) {
+        Payment payment;
+        payment.id = std::string(reader.readString16());
+        payment.amount = reader.readI64();
+        payment.currency = std::string(reader.readString16());
+        payment.status = std::string(reader.readString16());
+        out.payments.push_back(std::move(payment));
+    }
+
+    return reader.ok();
+}
+
+} // namespace Defiant
@@ -0,0 +1,198 @@
+#include "defiant/core/state_persistence.hpp"
+#include <emscripten.h>
+#include <emscripten/val.h>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Defiant {
+
+namespace {
+
+using Snapshot = std::vector<std::pair<std::string, nlohmann::json>>;
+
+// One long-lived writer thread serializes all snapshots. Spawning a
+// detached thread per flush would claim a fresh pthread-pool slot each
+// time (PTHREAD_POOL_SIZE is 4, and the chart worker holds one slot
+// permanently), so a burst of flushes could exhaust the pool and block
+// the main thread on thread creation.
+std::mutex writer_mutex;
+std::condition_variable writer_cv;
+std::deque<Snapshot> writer_queue;
+bool writer_started = false;
+
+void writerLoop() {
+    while (true) {
+        Snapshot snapshot;
+        {
+            std::unique_lock<std::mutex> lock(writer_mutex);
+            writer_cv.wait(lock, [] { return !writer_queue.empty(); });
+            snapshot = std::move(writer_queue.front());
+            writer_queue.pop_front();
+        }
+
+        for (const auto& entry : snapshot) {
+            std::string serialized = entry.second.dump();
+            // localStorage only exists on the main thread; hand it the
+            // finished strings and let it free them after writing
+            MAIN_THREAD_ASYNC_EM_ASM({
+                localStorage.setItem(UTF8ToString($0), UTF8ToString($1));
+                _free($0);
+                _free($1);
+            }, strdup(entry.first.c_str()), strdup(serialized.c_str()));
+        }
+    }
+}
+
+} // namespace
+
+StatePersistence::StatePersistence(nlohmann::json& state,
+                                   std::string key_prefix,
+                                   int debounce_ms)
+    : state(state), key_prefix(std::move(key_prefix)), debounce_ms(debounce_ms) {}
+
+void StatePersistence::markDirty(const std::string& section) {
+    if (!all_dirty) {
+        dirty_sections.insert(section);
+    }
+    scheduleFlush();
+}
+
+void StatePersistence::markAllDirty() {
+    all_dirty = true;
+    dirty_sections.clear();
+    scheduleFlush();
+}
+
+void StatePersistence::scheduleFlush() {
+    if (flush_pending) {
+        return;
+    }
+    flush_pending = true;
+    emscripten_async_call(&StatePersistence::onDebounceTimer, this, debounce_ms);
+}
+
+void StatePersistence::onDebounceTimer(void* user_data) {
+    auto* self = static_cast<StatePersistence*>(user_data);
+    self->flush_pending = false;
+    self->flushAsync();
+}
+
+void StatePersistence::flushAsync() {
+    if (!all_dirty && dirty_sections.empty()) {
+        return;
+    }
+
+    // Snapshot the dirty subtrees on the main thread (cheap structural
+    // copy); the expensive dump() runs on the writer thread
+    Snapshot snapshot;
+    nlohmann::json index = nlohmann::json::array();
+
+    for (auto it = state.begin(); it != state.end(); ++it) {
+        index.push_back(it.key());
+        if (all_dirty || dirty_sections.count(it.key())) {
+            snapshot.emplace_back(sectionKey(it.key()), it.value());
+        }
+    }
+    snapshot.emplace_back(indexKey(), std::move(index));
+
+    all_dirty = false;
+    dirty_sections.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(writer_mutex);
+        if (!writer_started) {
+            writer_started = true;
+            std::thread(writerLoop).detach();
+        }
+        writer_queue.push_back(std::move(snapshot));
+    }
+    writer_cv.notify_one();
+}
+
+void StatePersistence::flush() {
+    nlohmann::json index = nlohmann::json::array();
+    for (auto it = state.begin(); it != state.end(); ++it) {
+        index.push_back(it.key());
+        writeItem(sectionKey(it.key()), it.value().dump());
+    }
+    writeItem(indexKey(), index.dump());
+
+    all_dirty = false;
+    dirty_sections.clear();
+}
+
+void StatePersistence::load() {
+    try {
+        emscripten::val localStorage = emscripten::val::global("localStorage");
+        emscripten::val index_val = localStorage.call<emscripten::val>(
+            "getItem", emscripten::val(indexKey()));
+
+        if (!index_val.isUndefined() && !index_val.isNull()) {
+            nlohmann::json index = nlohmann::json::parse(index_val.as<std::string>());
+            for (const auto& section : index) {
+                std::string name = section.get<std::string>();
+                emscripten::val item = localStorage.call<emscripten::val>(
+                    "getItem", emscripten::val(sectionKey(name)));
+                if (!item.isUndefined() && !item.isNull()) {
+                    state[name] = nlohmann::json::parse(item.as<std::string>());
+                }
+            }
+            return;
+        }
+
+        // Fall back to the monolithic blob from previous releases
+        emscripten::val legacy = localStorage.call<emscripten::val>(
+            "getItem", emscripten::val(key_prefix));
+        if (!legacy.isUndefined() && !legacy.isNull()) {
+            state = nlohmann::json::parse(legacy.as<std::string>());
+        }
+    } catch (...) {
+        // If loading fails, leave whatever defaults the caller set up
+    }
+}
+
+void StatePersistence::clearStorage() {
+    try {
+        emscripten::val localStorage = emscripten::val::global("localStorage");
+        emscripten::val index_val = localStorage.call<emscripten::val>(
+            "getItem", emscripten::val(indexKey()));
+
+        if (!index_val.isUndefined() && !index_val.isNull()) {
+            nlohmann::json index = nlohmann::json::parse(index_val.as<std::string>());
+            for (const auto& section : index) {
+                localStorage.call<void>("removeItem",
+                    emscripten::val(sectionKey(section.get<std::string>())));
+            }
+        }
+        localStorage.call<void>("removeItem", emscripten::val(indexKey()));
+        localStorage.call<void>("removeItem", emscripten::val(key_prefix));
+    } catch (...) {
+        // Silently fail if localStorage is not available
+    }
+}
+
+std::string StatePersistence::sectionKey(const std::string& section) const {
+    return key_prefix + "." + section;
+}
+
+std::string StatePersistence::indexKey() const {
+    return key_prefix + ".__sections";
+}
+
+void StatePersistence::writeItem(const std::string& key, const std::string& value) {
+    try {
+        emscripten::val localStorage = emscripten::val::global("localStorage");
+        localStorage.call<void>("setItem",
+                               emscripten::val(key),
+                               emscripten::val(value));
+    } catch (...) {
+        // Silently fail if localStorage is not available
+    }
+}
+
+} // namespace Defiant
@@ -0,0 +1,33 @@
+#include "defiant/core/task.hpp"
+#include <emscripten.h>
+
+namespace Defiant {
+
+MainLoopExecutor& MainLoopExecutor::instance() {
+    static MainLoopExecutor executor;
+    return executor;
+}
+
+namespace {
+
+void runPosted(void* user_data) {
+    auto* fn = static_cast<std::function<void()>*>(user_data);
+    (*fn)();
+    delete fn;
+}
+
+void resumeHandle(void* user_data) {
+    std::coroutine_handle<>::from_address(user_data).resume();
+}
+
+} // namespace
+
+void MainLoopExecutor::post(std::function<void()> fn) {
+    emscripten_async_call(&runPosted, new std::function<void()>(std::move(fn)), 0);
+}
+
+void MainLoopExecutor::ScheduleAwaiter::await_suspend(std::coroutine_handle<> handle) {
+    emscripten_async_call(&resumeHandle, handle.address(), 0);
+}
+
+} // namespace Defiant
@@ -0,0 +1,97 @@
+#include "defiant/ui/animations.hpp"
+#include "defiant/core/arena.hpp"
+#include "defiant/ui/vdom.hpp"
+
+#include <algorithm>
+
+namespace Defiant {
+
+namespace {
+
+// Smooth-step approximation of the theme's cubic-bezier(0.4, 0, 0.2, 1)
+double ease(double t) {
+    t = std::clamp(t, 0.0, 1.0);
+    return t * t * (3.0 - 2.0 * t);
+}
+
+} // namespace
+
+AnimationScheduler& AnimationScheduler::instance() {
+    static AnimationScheduler scheduler;
+    return scheduler;
+}
+
+void AnimationScheduler::animate(const std::string& target,
+                                 AnimProperty property, double from,
+                                 double to, double duration,
+                                 bool hide_on_end) {
+    // Restarting the same channel replaces the running animation instead
+    // of fighting it
+    for (ActiveAnimation& anim : animations) {
+        if (anim.target == target && anim.property == property) {
+            anim.from = from;
+            anim.to = to;
+            anim.elapsed = 0.0;
+            anim.duration = duration;
+            anim.hide_on_end = hide_on_end;
+            return;
+        }
+    }
+
+    animations.push_back(
+        {target, property, from, to, 0.0, duration, hide_on_end});
+}
+
+void AnimationScheduler::cancel(const std::string& target) {
+    animations.erase(
+        std::remove_if(animations.begin(), animations.end(),
+                       [&](const ActiveAnimation& anim) {
+                           return anim.target == target;
+                       }),
+        animations.end());
+}
+
+void AnimationScheduler::step(double delta_time) {
+    if (animations.empty()) {
+        return;
+    }
+
+    DomBatch& batch = DomBatch::instance();
+
+    for (ActiveAnimation& anim : animations) {
+        anim.elapsed += delta_time;
+        double t = anim.duration > 0.0 ? anim.elapsed / anim.duration : 1.0;
+        double value = anim.from + (anim.to - anim.from) * ease(t);
+
+        switch (anim.property) {
+            case AnimProperty::Opacity:
+                batch.queue(DomMutation::Type::SetStyle, anim.target,
+                            "opacity", FrameArena::format("%.4f", value));
+                break;
+            case AnimProperty::TranslateX:
+                batch.queue(DomMutation::Type::SetStyle, anim.target,
+                            "transform",
+                            FrameArena::format("translateX(%.2fpx)", value));
+                break;
+            case AnimProperty::TranslateY:
+                batch.queue(DomMutation::Type::SetStyle, anim.target,
+                            "transform",
+                            FrameArena::format("translateY(%.2fpx)", value));
+                break;
+        }
+
+        if (t >= 1.0 && anim.hide_on_end) {
+            batch.queue(DomMutation::Type::SetStyle, anim.target, "display",
+                        "none");
+        }
+    }
+
+    animations.erase(
+        std::remove_if(animations.begin(), animations.end(),
+                       [](const ActiveAnimation& anim) {
+                           return anim.elapsed >= anim.duration;
+                       }),
+        animations.end());
+}
+
+} // namespace Defiant
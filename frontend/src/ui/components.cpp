@@ -1,10 +1,16 @@
 #include "defiant/ui/components.hpp"
+#include "defiant/core/perf.hpp"
+#include "defiant/ui/animations.hpp"
+#include "defiant/ui/templates.hpp"
+#include "defiant/ui/vdom.hpp"
+#include "defiant/core/arena.hpp"
+#include "defiant/wasm/shared_chart_renderer.hpp"
 #include "defiant/wasm/webgl_renderer.hpp"
 #include <emscripten/val.h>
 #include <emscripten/bind.h>
-#include <random>
-#include <sstream>
-#include <iomanip>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
 
 namespace Defiant {
 
@@ -20,7 +26,34 @@ Component::~Component() {
     destroy();
 }
 
+void Component::renderLazy(emscripten::val parent, HydrationPriority priority) {
+    hydrated = false;
+
+    // Placeholder holds the layout slot and gives the observer a target
+    emscripten::val document = emscripten::val::global("document");
+    emscripten::val placeholder =
+        document.call<emscripten::val>("createElement", std::string("div"));
+    std::string placeholder_id = id + "-hydration";
+    placeholder.set("id", placeholder_id);
+    placeholder.set("className", std::string("defiant-hydration-placeholder"));
+    parent.call<void>("appendChild", placeholder);
+
+    HydrationScheduler::instance().observe(
+        placeholder_id, priority, [this, parent, placeholder]() mutable {
+            emscripten::val holder_parent = placeholder["parentNode"];
+            if (!holder_parent.isUndefined() && !holder_parent.isNull()) {
+                holder_parent.call<void>("removeChild", placeholder);
+            }
+            hydrated = true;
+            render(parent);
+        });
+}
+
 void Component::destroy() {
+    AnimationScheduler::instance().cancel(id);
+    if (!hydrated) {
+        HydrationScheduler::instance().unobserve(id + "-hydration");
+    }
     if (!element.isUndefined() && !element.isNull()) {
         try {
             emscripten::val parent = element["parentNode"];
@@ -52,10 +85,14 @@ void Component::show() {
 void Component::hide() {
     if (visible) {
         visible = false;
-        fadeOut();
-        emscripten::val::global("setTimeout")(emscripten::val::module_property("setDisplayNone"),
-                                            emscripten::val(animation.duration * 1000),
-                                            element);
+        if (animation.enabled) {
+            // The scheduler flips display:none itself once the fade lands
+            AnimationScheduler::instance().animate(
+                id, AnimProperty::Opacity, 1.0, 0.0, animation.duration,
+                /*hide_on_end=*/true);
+        } else {
+            setStyle("display", "none");
+        }
     }
 }
 
@@ -69,92 +106,93 @@ void Component::toggle() {
 
 void Component::fadeIn(double duration) {
     if (!animation.enabled) return;
-    
+
+    // Interpolation happens in C++ now; make sure a stale CSS transition
+    // doesn't double-animate the same property
+    setStyle("transition", "");
     setStyle("opacity", "0");
-    setStyle("transition", 
-             "opacity " + std::to_string(duration) + "s " + animation.easing);
-    
-    emscripten::val::global("setTimeout")(emscripten::val::module_property("setOpacity"),
-                                        emscripten::val(10),
-                                        element,
-                                        emscripten::val(1.0));
+    AnimationScheduler::instance().animate(id, AnimProperty::Opacity, 0.0, 1.0,
+                                           duration);
 }
 
 void Component::fadeOut(double duration) {
     if (!animation.enabled) return;
-    
-    setStyle("transition", 
-             "opacity " + std::to_string(duration) + "s " + animation.easing);
-    setStyle("opacity", "0");
+
+    setStyle("transition", "");
+    AnimationScheduler::instance().animate(id, AnimProperty::Opacity, 1.0, 0.0,
+                                           duration);
 }
 
 void Component::slideIn(const std::string& direction, double duration) {
     if (!animation.enabled) return;
-    
-    std::string transform;
-    if (direction == "up") transform = "translateY(20px)";
-    else if (direction == "down") transform = "translateY(-20px)";
-    else if (direction == "left") transform = "translateX(20px)";
-    else if (direction == "right") transform = "translateX(-20px)";
-    else transform = "translateY(20px)";
-    
-    setStyle("transform", transform);
-    setStyle("opacity", "0");
-    setStyle("transition", 
-             "transform " + std::to_string(duration) + "s " + animation.easing + ", " +
-             "opacity " + std::to_string(duration) + "s " + animation.easing);
-    
-    emscripten::val::global("setTimeout")(emscripten::val::module_property("resetTransform"),
-                                        emscripten::val(10),
-                                        element);
-    emscripten::val::global("setTimeout")(emscripten::val::module_property("setOpacity"),
-                                        emscripten::val(10),
-                                        element,
-                                        emscripten::val(1.0));
+
+    AnimProperty axis = AnimProperty::TranslateY;
+    double offset = 20.0;
+    if (direction == "down") offset = -20.0;
+    else if (direction == "left") axis = AnimProperty::TranslateX;
+    else if (direction == "right") { axis = AnimProperty::TranslateX; offset = -20.0; }
+
+    setStyle("transition", "");
+    AnimationScheduler& scheduler = AnimationScheduler::instance();
+    scheduler.animate(id, axis, offset, 0.0, duration);
+    scheduler.animate(id, AnimProperty::Opacity, 0.0, 1.0, duration);
 }
 
 void Component::slideOut(const std::string& direction, double duration) {
     if (!animation.enabled) return;
-    
-    std::string transform;
-    if (direction == "up") transform = "translateY(-20px)";
-    else if (direction == "down") transform = "translateY(20px)";
-    else if (direction == "left") transform = "translateX(-20px)";
-    else if (direction == "right") transform = "translateX(20px)";
-    else transform = "translateY(-20px)";
-    
-    setStyle("transition", 
-             "transform " + std::to_string(duration) + "s " + animation.easing + ", " +
-             "opacity " + std::to_string(duration) + "s " + animation.easing);
-    setStyle("transform", transform);
-    setStyle("opacity", "0");
+
+    AnimProperty axis = AnimProperty::TranslateY;
+    double offset = -20.0;
+    if (direction == "down") offset = 20.0;
+    else if (direction == "left") { axis = AnimProperty::TranslateX; }
+    else if (direction == "right") { axis = AnimProperty::TranslateX; offset = 20.0; }
+
+    setStyle("transition", "");
+    AnimationScheduler& scheduler = AnimationScheduler::instance();
+    scheduler.animate(id, axis, 0.0, offset, duration);
+    scheduler.animate(id, AnimProperty::Opacity, 1.0, 0.0, duration);
 }
 
 void Component::addClass(const std::string& className) {
     if (!element.isUndefined() && !element.isNull()) {
-        element["classList"].call<void>("add", emscripten::val(className));
+        DomBatch::instance().queue(DomMutation::Type::AddClass, id, className);
     }
 }
 
 void Component::removeClass(const std::string& className) {
     if (!element.isUndefined() && !element.isNull()) {
-        element["classList"].call<void>("remove", emscripten::val(className));
+        DomBatch::instance().queue(DomMutation::Type::RemoveClass, id, className);
+    }
+}
+
+void Component::addClass(DomToken token) {
+    if (!element.isUndefined() && !element.isNull()) {
+        DomBatch::instance().queueToken(DomMutation::Type::AddClass, id, token);
+    }
+}
+
+void Component::removeClass(DomToken token) {
+    if (!element.isUndefined() && !element.isNull()) {
+        DomBatch::instance().queueToken(DomMutation::Type::RemoveClass, id, token);
+    }
+}
+
+void Component::setStyle(DomToken property, const std::string& value) {
+    if (!element.isUndefined() && !element.isNull()) {
+        DomBatch::instance().queueToken(DomMutation::Type::SetStyle, id,
+                                        property, value);
     }
 }
 
 void Component::setStyle(const std::string& property, const std::string& value) {
     if (!element.isUndefined() && !element.isNull()) {
-        element["style"].call<void>("setProperty", 
-                                   emscripten::val(property),
-                                   emscripten::val(value));
+        DomBatch::instance().queue(DomMutation::Type::SetStyle, id, property, value);
     }
 }
 
 void Component::setAttribute(const std::string& name, const std::string& value) {
     if (!element.isUndefined() && !element.isNull()) {
-        element.call<void>("setAttribute", 
-                          emscripten::val(name),
-                          emscripten::val(value));
+        DomBatch::instance().queue(DomMutation::Type::SetAttribute, id, name, value);
     }
 }
 
@@ -182,21 +220,21 @@ void Component::createElement(const std::string& tag) {
 
 void Component::setInnerHTML(const std::string& html) {
     if (!element.isUndefined() && !element.isNull()) {
-        element.set("innerHTML", emscripten::val(html));
+        DomBatch::instance().queue(DomMutation::Type::SetInnerHTML, id, "", html);
     }
 }
 
 std::string Component::generateId() {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(0, 35);
-    const char* chars = "abcdefghijklmnopqrstuvwxyz0123456789";
-    
-    std::string id = "comp_";
-    for (int i = 0; i < 8; ++i) {
-        id += chars[dis(gen)];
-    }
-    return id;
+    // These ids only need to be unique, not unpredictable, so a
+    // monotonic counter replaces the per-call random_device + Mersenne
+    // Twister this used to construct (2.5KB of state reseeded for every
+    // component during a dashboard render)
+    static std::atomic<uint32_t> next_id{1};
+    char buf[20];
+    int length = std::snprintf(
+        buf, sizeof(buf), "comp_%u",
+        next_id.fetch_add(1, std::memory_order_relaxed));
+    return std::string(buf, static_cast<size_t>(length));
 }
 
 // Button component
@@ -205,89 +243,146 @@ Button::Button(const std::string& text,
                const std::string& id)
     : Component(id), text(text), onClick(onClick) {}
 
+namespace {
+
+// Button class tokens, interned once on first use; the update hot path
+// only ever touches these integers
+DomToken buttonVariantToken(const std::string& variant) {
+    static const std::pair<const char*, DomToken> kVariants[] = {
+        {"primary", DomTokenTable::instance().intern("defiant-button-primary")},
+        {"secondary", DomTokenTable::instance().intern("defiant-button-secondary")},
+        {"outline", DomTokenTable::instance().intern("defiant-button-outline")},
+        {"danger", DomTokenTable::instance().intern("defiant-button-danger")},
+    };
+    for (const auto& [name, token] : kVariants) {
+        if (variant == name) {
+            return token;
+        }
+    }
+    return kVariants[0].second;
+}
+
+DomToken buttonSizeToken(const std::string& size) {
+    static const std::pair<const char*, DomToken> kSizes[] = {
+        {"small", DomTokenTable::instance().intern("defiant-button-small")},
+        {"medium", DomTokenTable::instance().intern("defiant-button-medium")},
+        {"large", DomTokenTable::instance().intern("defiant-button-large")},
+    };
+    for (const auto& [name, token] : kSizes) {
+        if (size == name) {
+            return token;
+        }
+    }
+    return kSizes[1].second;
+}
+
+DomToken buttonDisabledToken() {
+    static const DomToken token =
+        DomTokenTable::instance().intern("defiant-button-disabled");
+    return token;
+}
+
+DomToken buttonLoadingToken() {
+    static const DomToken token =
+        DomTokenTable::instance().intern("defiant-button-loading");
+    return token;
+}
+
+} // namespace
+
 void Button::render(emscripten::val parent) {
     createElement("button");
-    
+
+    static const DomToken kBase =
+        DomTokenTable::instance().intern("defiant-button");
+
     // Set base styles
     setInnerHTML(text);
-    addClass("defiant-button");
-    addClass("defiant-button-" + variant);
-    addClass("defiant-button-" + size);
-    
+    addClass(kBase);
+    applied_variant = buttonVariantToken(variant);
+    addClass(applied_variant);
+    applied_size = buttonSizeToken(size);
+    addClass(applied_size);
+
     if (disabled) {
-        addClass("defiant-button-disabled");
+        addClass(buttonDisabledToken());
         setAttribute("disabled", "true");
     }
-    
+
     if (loading) {
-        addClass("defiant-button-loading");
+        addClass(buttonLoadingToken());
         setInnerHTML("<span class='defiant-button-spinner'></span>" + text);
     }
-    
+
     // Add click handler
     if (onClick) {
         auto callback = emscripten::val::module_property("createButtonCallback");
         addEventListener("click", callback);
     }
-    
+
     // Append to parent
     parent.call<void>("appendChild", element);
 }
 
 void Button::update() {
+    DEFIANT_PERF_SCOPE("Button::update");
     if (!element.isUndefined() && !element.isNull()) {
-        setInnerHTML(text);
-        
-        // Update classes
-        std::vector<std::string> variants = {"primary", "secondary", "outline", "danger"};
-        for (const auto& v : variants) {
-            if (v != variant) {
-                removeClass("defiant-button-" + v);
+        // Swap only the class that actually changed; no string compares,
+        // no removeClass round trips for classes that were never set
+        DomToken variant_token = buttonVariantToken(variant);
+        if (variant_token != applied_variant) {
+            if (applied_variant != 0) {
+                removeClass(applied_variant);
             }
+            addClass(variant_token);
+            applied_variant = variant_token;
         }
-        addClass("defiant-button-" + variant);
-        
-        // Update size
-        std::vector<std::string> sizes = {"small", "medium", "large"};
-        for (const auto& s : sizes) {
-            if (s != size) {
-                removeClass("defiant-button-" + s);
+
+        DomToken size_token = buttonSizeToken(size);
+        if (size_token != applied_size) {
+            if (applied_size != 0) {
+                removeClass(applied_size);
             }
+            addClass(size_token);
+            applied_size = size_token;
         }
-        addClass("defiant-button-" + size);
-        
+
         // Update disabled state
         if (disabled) {
-            addClass("defiant-button-disabled");
+            addClass(buttonDisabledToken());
             setAttribute("disabled", "true");
         } else {
-            removeClass("defiant-button-disabled");
-            element.call<void>("removeAttribute", emscripten::val("disabled"));
+            removeClass(buttonDisabledToken());
+            // Must go through the batch: an immediate removal would lose
+            // to a still-queued SetAttribute from an earlier
+            // setDisabled(true) in the same frame
+            DomBatch::instance().queue(DomMutation::Type::RemoveAttribute,
+                                       id, "disabled");
         }
-        
+
         // Update loading state
         if (loading) {
-            addClass("defiant-button-loading");
+            addClass(buttonLoadingToken());
             setInnerHTML("<span class='defiant-button-spinner'></span>" + text);
         } else {
-            removeClass("defiant-button-loading");
+            removeClass(buttonLoadingToken());
             setInnerHTML(text);
         }
     }
 }
 
-void Button::setText(const std::string& newText) {
-    text = newText;
+void Button::setText(std::string newText) {
+    text = std::move(newText);
     update();
 }
 
-void Button::setVariant(const std::string& newVariant) {
-    variant = newVariant;
+void Button::setVariant(std::string newVariant) {
+    variant = std::move(newVariant);
     update();
 }
 
-void Button::setSize(const std::string& newSize) {
-    size = newSize;
+void Button::setSize(std::string newSize) {
+    size = std::move(newSize);
     update();
 }
 
@@ -305,55 +400,66 @@ void Button::setLoading(bool isLoading) {
 Input::Input(const std::string& type, const std::string& id)
     : Component(id), type(type) {}
 
+// Static structure baked into one HTML string at build time; render()
+// instantiates it with a single innerHTML write and binds the dynamic
+// slots afterwards
+namespace {
+
+constexpr auto kInputTemplate = Templates::concat(
+    "<label data-slot=\"label\" style=\"display:none\"></label>",
+    "<input data-slot=\"input\" />",
+    "<div class=\"defiant-input-error\" data-slot=\"error\"></div>");
+
+} // namespace
+
 void Input::render(emscripten::val parent) {
     createElement("div");
     addClass("defiant-input-container");
-    
-    // Create label if provided
+
+    // One boundary call for the whole static structure
+    element.set("innerHTML", emscripten::val(kInputTemplate.c_str()));
+
+    // Bind dynamic slots: label, input state, error text
+    emscripten::val labelEl = Templates::slot(element, "label");
     if (!label.empty()) {
-        emscripten::val labelEl = emscripten::val::global("document")
-            .call<emscripten::val>("createElement", emscripten::val("label"));
-        labelEl.set("innerHTML", emscripten::val(label));
-        labelEl.call<void>("setAttribute", emscripten::val("for"), emscripten::val(id + "_input"));
-        element.call<void>("appendChild", labelEl);
+        labelEl.set("textContent", emscripten::val(label));
+        labelEl.call<void>("setAttribute", emscripten::val("for"),
+                           emscripten::val(id + "_input"));
+        labelEl["style"].set("display", emscripten::val(""));
     }
-    
-    // Create input element
-    emscripten::val inputEl = emscripten::val::global("document")
-        .call<emscripten::val>("createElement", emscripten::val("input"));
+
+    emscripten::val inputEl = Templates::slot(element, "input");
     inputEl.call<void>("setAttribute", emscripten::val("id"), emscripten::val(id + "_input"));
     inputEl.call<void>("setAttribute", emscripten::val("type"), emscripten::val(type));
-    inputEl.call<void>("setAttribute", emscripten::val("placeholder"), emscripten::val(placeholder));
-    inputEl.set("value", emscripten::val(value));
-    
+    if (!placeholder.empty()) {
+        inputEl.call<void>("setAttribute", emscripten::val("placeholder"),
+                           emscripten::val(placeholder));
+    }
+    if (!value.empty()) {
+        inputEl.set("value", emscripten::val(value));
+    }
     if (required) {
         inputEl.call<void>("setAttribute", emscripten::val("required"), emscripten::val("true"));
     }
-    
     if (disabled) {
         inputEl.call<void>("setAttribute", emscripten::val("disabled"), emscripten::val("true"));
     }
-    
+
     // Add event listeners
     if (onChange) {
         inputEl.call<void>("addEventListener", emscripten::val("input"),
             emscripten::val::module_property("createInputChangeCallback"));
     }
-    
+
     if (onBlur) {
         inputEl.call<void>("addEventListener", emscripten::val("blur"),
             emscripten::val::module_property("createInputBlurCallback"));
     }
-    
-    element.call<void>("appendChild", inputEl);
-    
-    // Create error message container
-    emscripten::val errorEl = emscripten::val::global("document")
-        .call<emscripten::val>("createElement", emscripten::val("div"));
-    errorEl.addClass("defiant-input-error");
-    errorEl.set("innerHTML", emscripten::val(error));
-    element.call<void>("appendChild", errorEl);
-    
+
+    if (!error.empty()) {
+        Templates::slot(element, "error").set("textContent", emscripten::val(error));
+    }
+
     // Append to parent
     parent.call<void>("appendChild", element);
 }
@@ -418,23 +524,23 @@ void Input::update() {
     }
 }
 
-void Input::setValue(const std::string& newValue) {
-    value = newValue;
+void Input::setValue(std::string newValue) {
+    value = std::move(newValue);
     update();
 }
 
-void Input::setPlaceholder(const std::string& newPlaceholder) {
-    placeholder = newPlaceholder;
+void Input::setPlaceholder(std::string newPlaceholder) {
+    placeholder = std::move(newPlaceholder);
     update();
 }
 
-void Input::setLabel(const std::string& newLabel) {
-    label = newLabel;
+void Input::setLabel(std::string newLabel) {
+    label = std::move(newLabel);
     update();
 }
 
-void Input::setError(const std::string& newError) {
-    error = newError;
+void Input::setError(std::string newError) {
+    error = std::move(newError);
     update();
 }
 
@@ -448,21 +554,435 @@ void Input::setDisabled(bool isDisabled) {
     update();
 }
 
+void Input::setValidator(const CompiledValidator* rules) {
+    validator = rules;
+}
+
 void Input::validate() {
-    // Basic validation logic
+    // Allocation-free per keystroke: the compiled program scans the value
+    // and fails with a pointer to a static message
+    const char* failure = nullptr;
     if (required && value.empty()) {
-        error = "This field is required";
-    } else if (type == "email" && !value.empty()) {
-        // Simple email validation
-        if (value.find('@') == std::string::npos) {
-            error = "Please enter a valid email address";
+        failure = "This field is required";
+    } else if (!value.empty()) {
+        const CompiledValidator* rules =
+            validator ? validator : CompiledValidator::forInputType(type);
+        if (rules) {
+            failure = rules->run(value);
+        }
+    }
+
+    // Touch the DOM only when the error state actually transitions
+    std::string_view new_error = failure ? failure : "";
+    if (error == new_error) {
+        return;
+    }
+    error.assign(new_error);
+    updateErrorSlot();
+}
+
+void Input::updateErrorSlot() {
+    if (element.isUndefined() || element.isNull()) {
+        return;
+    }
+    emscripten::val errorEl = Templates::slot(element, "error");
+    if (errorEl.isUndefined() || errorEl.isNull()) {
+        return;
+    }
+    errorEl.set("textContent", emscripten::val(error));
+    errorEl["style"].set("display",
+                         emscripten::val(error.empty() ? "none" : "block"));
+}
+
+// Table component (keyed reconciliation path)
+void Table::setKeyColumn(int column) {
+    keyColumn = column;
+}
+
+void Table::setData(const std::vector<std::vector<std::string>>& newData) {
+    // One copy, then the move path; lvalue callers pay exactly what they
+    // did before
+    setData(std::vector<std::vector<std::string>>(newData));
+}
+
+void Table::setData(std::vector<std::vector<std::string>>&& newData) {
+    DEFIANT_PERF_SCOPE("Table::setData");
+    bool canReconcile = keyColumn >= 0 &&
+                        !element.isUndefined() && !element.isNull() &&
+                        !rowNodes.empty();
+
+    if (canReconcile) {
+        std::vector<std::vector<std::string>> oldPage = getPageData();
+        data = std::move(newData);
+        totalItems = static_cast<int>(data.size());
+        reconcileRows(oldPage, getPageData());
+        renderPagination();
+        return;
+    }
+
+    // Full rebuild path (first render, or keyed mode not enabled)
+    data = std::move(newData);
+    totalItems = static_cast<int>(data.size());
+    rowNodes.clear();
+    update();
+
+    if (keyColumn >= 0) {
+        indexRowNodes();
+    }
+}
+
+std::vector<std::vector<std::string>> Table::getPageData() {
+    std::vector<std::vector<std::string>> page;
+    size_t start = static_cast<size_t>(currentPage - 1) * pageSize;
+    size_t end = std::min(start + pageSize, data.size());
+    for (size_t i = start; i < end; ++i) {
+        page.push_back(data[i]);
+    }
+    return page;
+}
+
+void Table::reconcileRows(const std::vector<std::vector<std::string>>& oldRows,
+                          const std::vector<std::vector<std::string>>& newRows) {
+    emscripten::val tbody = element.call<emscripten::val>("querySelector",
+                                                          emscripten::val("tbody"));
+    if (tbody.isUndefined() || tbody.isNull()) {
+        rowNodes.clear();
+        update();
+        return;
+    }
+
+    // Index the previous page by key so unchanged rows keep their DOM nodes
+    std::unordered_map<std::string, size_t> oldIndex;
+    for (size_t i = 0; i < oldRows.size(); ++i) {
+        if (static_cast<size_t>(keyColumn) < oldRows[i].size()) {
+            oldIndex[oldRows[i][keyColumn]] = i;
+        }
+    }
+
+    std::unordered_map<std::string, emscripten::val> nextNodes;
+    emscripten::val children = tbody["children"];
+
+    for (size_t i = 0; i < newRows.size(); ++i) {
+        const auto& newRow = newRows[i];
+        if (static_cast<size_t>(keyColumn) >= newRow.size()) {
+            continue;
+        }
+        const std::string& key = newRow[keyColumn];
+
+        emscripten::val node = emscripten::val::undefined();
+        auto nodeIt = rowNodes.find(key);
+        auto oldIt = oldIndex.find(key);
+
+        if (nodeIt != rowNodes.end() && oldIt != oldIndex.end()) {
+            // Existing row: patch only the cells whose text actually changed
+            node = nodeIt->second;
+            const auto& oldRow = oldRows[oldIt->second];
+            emscripten::val cells = node["children"];
+            for (size_t c = 0; c < newRow.size(); ++c) {
+                if (c >= oldRow.size() || oldRow[c] != newRow[c]) {
+                    emscripten::val cell = cells[c];
+                    if (!cell.isUndefined() && !cell.isNull()) {
+                        cell.set("textContent", emscripten::val(newRow[c]));
+                    }
+                }
+            }
         } else {
-            error = "";
+            node = createRowNode(newRow);
+        }
+
+        // Keep DOM order in sync; insertBefore moves existing nodes in place
+        emscripten::val current = children[i];
+        if (current.isUndefined() || !current.strictlyEquals(node)) {
+            tbody.call<void>("insertBefore", node,
+                             current.isUndefined() ? emscripten::val::null() : current);
+        }
+        nextNodes.emplace(key, node);
+    }
+
+    // Drop rows whose keys disappeared
+    for (auto& entry : rowNodes) {
+        if (nextNodes.find(entry.first) == nextNodes.end()) {
+            emscripten::val parent = entry.second["parentNode"];
+            if (!parent.isUndefined() && !parent.isNull()) {
+                parent.call<void>("removeChild", entry.second);
+            }
+        }
+    }
+
+    rowNodes = std::move(nextNodes);
+}
+
+void Table::indexRowNodes() {
+    rowNodes.clear();
+    if (element.isUndefined() || element.isNull()) {
+        return;
+    }
+
+    emscripten::val tbody = element.call<emscripten::val>("querySelector",
+                                                          emscripten::val("tbody"));
+    if (tbody.isUndefined() || tbody.isNull()) {
+        return;
+    }
+
+    // renderBody emits rows in page-data order, so map them back by position
+    std::vector<std::vector<std::string>> page = getPageData();
+    emscripten::val rows = tbody["children"];
+    int count = rows["length"].as<int>();
+
+    for (int i = 0; i < count && static_cast<size_t>(i) < page.size(); ++i) {
+        if (static_cast<size_t>(keyColumn) < page[i].size()) {
+            rowNodes.emplace(page[i][keyColumn], rows[i]);
+        }
+    }
+}
+
+emscripten::val Table::createRowNode(const std::vector<std::string>& row) {
+    emscripten::val document = emscripten::val::global("document");
+    emscripten::val tr = document.call<emscripten::val>("createElement", emscripten::val("tr"));
+    tr.call<void>("setAttribute", emscripten::val("class"), emscripten::val("defiant-table-row"));
+
+    for (const auto& cell : row) {
+        emscripten::val td = document.call<emscripten::val>("createElement", emscripten::val("td"));
+        td.set("textContent", emscripten::val(cell));
+        tr.call<void>("appendChild", td);
+    }
+    return tr;
+}
+
+// Chart component (async data preparation path)
+bool Chart::use_shared_renderer = false;
+
+void Chart::setUseSharedRenderer(bool enabled) {
+    use_shared_renderer = enabled;
+}
+
+Chart::~Chart() {
+    if (shared_handle >= 0) {
+        SharedChartRenderer::instance().unregisterChart(shared_handle);
+    }
+}
+
+void Chart::setData(const nlohmann::json& newData) {
+    data = newData;
+    prepareDataAsync();
+}
+
+void Chart::updateData(const nlohmann::json& newData) {
+    data = newData;
+    prepareDataAsync();
+}
+
+void Chart::prepareDataAsync() {
+    // Cheap single scan to pull the series out of the JSON; the heavy
+    // binning and aggregation happens on a worker thread
+    std::vector<double> values;
+    if (data.contains("values") && data["values"].is_array()) {
+        values.reserve(data["values"].size());
+        for (const auto& v : data["values"]) {
+            if (v.is_number()) {
+                values.push_back(v.get<double>());
+            }
+        }
+    }
+
+    // Two points per pixel column is as much as the canvas can show
+    size_t target_points = width > 0 ? static_cast<size_t>(width) : 512;
+
+    std::weak_ptr<bool> guard = alive;
+    ChartWorkerPool::instance().prepare(std::move(values), target_points,
+        [this, guard](ChartVertexBuffer buffer) {
+            if (guard.expired()) {
+                return; // chart was destroyed while the worker ran
+            }
+            vertex_buffer = std::move(buffer);
+
+            if (use_shared_renderer) {
+                // One context for all charts: hand the geometry to the
+                // batched renderer, which redraws every chart in one pass
+                SharedChartRenderer& shared = SharedChartRenderer::instance();
+                if (shared_handle < 0) {
+                    shared_handle = shared.registerChart(id);
+                }
+                if (shared_handle >= 0) {
+                    // Scissor/viewport rect on the shared overlay canvas:
+                    // the chart's live layout position, flipped to GL's
+                    // bottom-left origin
+                    int rect_x = 0;
+                    int rect_y = 0;
+                    int rect_w = width;
+                    int rect_h = height;
+                    if (!element.isUndefined() && !element.isNull()) {
+                        emscripten::val rect = element.call<emscripten::val>(
+                            "getBoundingClientRect");
+                        int viewport_h = emscripten::val::global("window")
+                                             ["innerHeight"].as<int>();
+                        rect_x = static_cast<int>(rect["left"].as<double>());
+                        rect_w = static_cast<int>(rect["width"].as<double>());
+                        rect_h = static_cast<int>(rect["height"].as<double>());
+                        if (rect_w <= 0) rect_w = width;
+                        if (rect_h <= 0) rect_h = height;
+                        rect_y = viewport_h -
+                                 (static_cast<int>(rect["top"].as<double>()) +
+                                  rect_h);
+                    }
+                    shared.updateGeometry(shared_handle, vertex_buffer,
+                                          rect_x, rect_y, rect_w, rect_h);
+                    return;
+                }
+                // Registration failed (no WebGL2?); fall through to the
+                // per-chart renderer
+            }
+            renderChart();
+        });
+}
+
+// Notification system
+namespace {
+
+struct ToastSlot {
+    emscripten::val node = emscripten::val::undefined();
+    bool active = false;
+};
+
+ToastSlot toast_slots[Notification::kMaxVisible];
+emscripten::val toast_container = emscripten::val::undefined();
+emscripten::val overflow_node = emscripten::val::undefined();
+int overflow_count = 0;
+
+} // namespace
+
+void Notification::ensureContainer() {
+    if (!toast_container.isUndefined() && !toast_container.isNull()) {
+        return;
+    }
+
+    emscripten::val document = emscripten::val::global("document");
+    toast_container = document.call<emscripten::val>("createElement", emscripten::val("div"));
+    toast_container.call<void>("setAttribute", emscripten::val("class"),
+                               emscripten::val("defiant-notifications"));
+    document["body"].call<void>("appendChild", toast_container);
+
+    // Pre-create the slot nodes once; every toast after this reuses them
+    for (int i = 0; i < kMaxVisible; ++i) {
+        emscripten::val node = document.call<emscripten::val>("createElement",
+                                                              emscripten::val("div"));
+        node["style"].set("display", "none");
+        toast_container.call<void>("appendChild", node);
+        toast_slots[i].node = node;
+    }
+
+    overflow_node = document.call<emscripten::val>("createElement", emscripten::val("div"));
+    overflow_node.call<void>("setAttribute", emscripten::val("class"),
+                             emscripten::val("defiant-notification defiant-notification-info"));
+    overflow_node["style"].set("display", "none");
+    toast_container.call<void>("appendChild", overflow_node);
+}
+
+int Notification::acquireSlot() {
+    for (int i = 0; i < kMaxVisible; ++i) {
+        if (!toast_slots[i].active) {
+            return i;
         }
+    }
+    return -1;
+}
+
+void Notification::renderSlot(int slot,
+                              const std::string& title,
+                              const std::string& message,
+                              const std::string& type) {
+    emscripten::val node = toast_slots[slot].node;
+    node.call<void>("setAttribute", emscripten::val("class"),
+                    emscripten::val("defiant-notification defiant-notification-" + type));
+    node.set("innerHTML",
+             emscripten::val("<strong>" + title + "</strong><span>" + message + "</span>"));
+    node["style"].set("display", "block");
+}
+
+void Notification::updateOverflowSummary() {
+    if (overflow_node.isUndefined() || overflow_node.isNull()) {
+        return;
+    }
+    if (overflow_count > 0) {
+        overflow_node.set("textContent",
+                          emscripten::val("+" + std::to_string(overflow_count) + " more"));
+        overflow_node["style"].set("display", "block");
     } else {
-        error = "";
+        overflow_node["style"].set("display", "none");
+    }
+}
+
+void Notification::show(const std::string& title,
+                        const std::string& message,
+                        const std::string& type) {
+    ensureContainer();
+
+    int slot = acquireSlot();
+    if (slot < 0) {
+        // Arrival rate exceeds display rate: coalesce instead of growing
+        ++overflow_count;
+        updateOverflowSummary();
+        return;
+    }
+
+    toast_slots[slot].active = true;
+    renderSlot(slot, title, message, type);
+
+    emscripten::val::global("setTimeout")(
+        emscripten::val::module_property("defiantExpireToast"),
+        emscripten::val(kDefaultDuration),
+        emscripten::val(slot));
+}
+
+void Notification::expireSlot(int slot) {
+    if (slot < 0 || slot >= kMaxVisible || !toast_slots[slot].active) {
+        return;
+    }
+
+    if (overflow_count > 0) {
+        // Drain the coalesced backlog through the freed slot: one summary
+        // toast stands in for the whole batch
+        int drained = overflow_count;
+        overflow_count = 0;
+        updateOverflowSummary();
+        renderSlot(slot, "Notifications",
+                   "+" + std::to_string(drained) + " more events", "info");
+        emscripten::val::global("setTimeout")(
+            emscripten::val::module_property("defiantExpireToast"),
+            emscripten::val(kDefaultDuration),
+            emscripten::val(slot));
+        return;
+    }
+
+    toast_slots[slot].active = false;
+    toast_slots[slot].node["style"].set("display", "none");
+}
+
+void Notification::success(const std::string& title, const std::string& message) {
+    show(title, message, "success");
+}
+
+void Notification::error(const std::string& title, const std::string& message) {
+    show(title, message, "error");
+}
+
+void Notification::warning(const std::string& title, const std::string& message) {
+    show(title, message, "warning");
+}
+
+void Notification::info(const std::string& title, const std::string& message) {
+    show(title, message, "info");
+}
+
+void Notification::clearAll() {
+    overflow_count = 0;
+    updateOverflowSummary();
+    for (int i = 0; i < kMaxVisible; ++i) {
+        if (toast_slots[i].active) {
+            toast_slots[i].active = false;
+            toast_slots[i].node["style"].set("display", "none");
+        }
     }
-    update();
 }
 
 // JavaScript callbacks
@@ -510,6 +1030,8 @@ EMSCRIPTEN_BINDINGS(component_callbacks) {
             element["style"].set("opacity", "1");
         }
     ));
+
+    emscripten::function("defiantExpireToast", &Notification::expireSlot);
 }
 
 } // namespace Defiant
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "defiant/ui/hydration.hpp"
+
+#include <algorithm>
+
+#include <emscripten.h>
+#include <emscripten/em_js.h>
+#include <emscripten/html5.h>
+
+namespace Defiant {
+
+namespace {
+
+// Hydrations applied per frame; keeps a burst of widgets scrolling into
+// view from blowing one frame's budget
+constexpr size_t kHydrationsPerFrame = 2;
+
+EM_BOOL onHydrationFrame(double /*time*/, void* user_data) {
+    static_cast<HydrationScheduler*>(user_data)->drain();
+    return EM_FALSE; // one-shot; re-armed while work remains
+}
+
+} // namespace
+
+// One shared observer for every lazy component. rootMargin starts
+// hydration a viewport-height early so widgets are usually ready by the
+// time they scroll in.
+EM_JS(void, defiant_hydration_observe, (const char* id), {
+    var observer = Module._defiantHydrationObserver;
+    if (!observer) {
+        observer = Module._defiantHydrationObserver =
+            new IntersectionObserver(function(entries) {
+                for (var i = 0; i < entries.length; ++i) {
+                    if (!entries[i].isIntersecting) continue;
+                    observer.unobserve(entries[i].target);
+                    var targetId = entries[i].target.id;
+                    var len = lengthBytesUTF8(targetId) + 1;
+                    var buf = _malloc(len);
+                    stringToUTF8(targetId, buf, len);
+                    _defiant_hydration_intersect(buf);
+                    _free(buf);
+                }
+            }, { rootMargin: '200px' });
+    }
+    var el = document.getElementById(UTF8ToString(id));
+    if (el) observer.observe(el);
+});
+
+EM_JS(void, defiant_hydration_unobserve, (const char* id), {
+    var observer = Module._defiantHydrationObserver;
+    var el = document.getElementById(UTF8ToString(id));
+    if (observer && el) observer.unobserve(el);
+});
+
+extern "C" EMSCRIPTEN_KEEPALIVE void defiant_hydration_intersect(
+    const char* id) {
+    HydrationScheduler::instance().onIntersect(id);
+}
+
+HydrationScheduler& HydrationScheduler::instance() {
+    static HydrationScheduler scheduler;
+    return scheduler;
+}
+
+void HydrationScheduler::observe(const std::string& target,
+                                 HydrationPriority priority,
+                                 std::function<void()> hydrate) {
+    pending[target] = {priority, std::move(hydrate)};
+    defiant_hydration_observe(target.c_str());
+}
+
+void HydrationScheduler::unobserve(const std::string& target) {
+    pending.erase(target);
+    ready.erase(std::remove_if(ready.begin(), ready.end(),
+                               [&](const auto& entry) {
+                                   return entry.first == target;
+                               }),
+                ready.end());
+    defiant_hydration_unobserve(target.c_str());
+}
+
+void HydrationScheduler::onIntersect(const std::string& target) {
+    auto it = pending.find(target);
+    if (it == pending.end()) {
+        return;
+    }
+
+    // Insert keeping the ready list priority-sorted; it is a handful of
+    // entries at worst
+    auto pos = std::find_if(ready.begin(), ready.end(),
+                            [&](const auto& entry) {
+                                return entry.second.priority >
+                                       it->second.priority;
+                            });
+    ready.emplace(pos, it->first, std::move(it->second));
+    pending.erase(it);
+
+    scheduleDrain();
+}
+
+void HydrationScheduler::drain() {
+    drain_scheduled = false;
+
+    size_t budget = std::min(kHydrationsPerFrame, ready.size());
+    for (size_t i = 0; i < budget; ++i) {
+        // Take from the front: highest priority first
+        std::function<void()> hydrate = std::move(ready.front().second.hydrate);
+        ready.erase(ready.begin());
+        if (hydrate) {
+            hydrate();
+        }
+    }
+
+    if (!ready.empty()) {
+        scheduleDrain();
+    }
+}
+
+void HydrationScheduler::scheduleDrain() {
+    if (!drain_scheduled) {
+        drain_scheduled = true;
+        emscripten_request_animation_frame(onHydrationFrame, this);
+    }
+}
+
+} // namespace Defiant
@@ -0,0 +1,237 @@
+#include "defiant/ui/vdom.hpp"
+#include "defiant/core/perf.hpp"
+#include <emscripten.h>
+#include <emscripten/html5.h>
+#include <nlohmann/json.hpp>
+
+namespace Defiant {
+
+// JS-side applier: one call per frame, element lookups and writes all stay
+// on the JS side. Elements are resolved by id through a small cache that is
+// invalidated when a node leaves the document.
+EM_JS(void, defiant_apply_dom_mutations, (const char* ops_json), {
+    var payload = JSON.parse(UTF8ToString(ops_json));
+    var cache = Module._defiantElementCache || (Module._defiantElementCache = {});
+    var tokens = Module._defiantDomTokens || (Module._defiantDomTokens = []);
+    var regs = payload.reg;
+    if (regs) {
+        for (var r = 0; r < regs.length; ++r) {
+            tokens[regs[r][0]] = regs[r][1];
+        }
+    }
+    var ops = payload.ops;
+    for (var i = 0; i < ops.length; ++i) {
+        var op = ops[i];
+        var el = cache[op.t];
+        if (el && !el.isConnected) {
+            // Destroyed component; drop the entry so the detached
+            // subtree can be collected
+            delete cache[op.t];
+            el = null;
+        }
+        if (!el) {
+            el = document.getElementById(op.t);
+            if (!el) continue;
+            cache[op.t] = el;
+        }
+        var n = op.k !== undefined ? tokens[op.k] : op.n;
+        switch (op.o) {
+            case 0: el.style.setProperty(n, op.v); break;
+            case 1: el.classList.add(n); break;
+            case 2: el.classList.remove(n); break;
+            case 3: el.setAttribute(n, op.v); break;
+            case 4: el.removeAttribute(n); break;
+            case 5: el.innerHTML = op.v; break;
+            case 6: el[n] = op.v; break;
+        }
+    }
+});
+
+namespace {
+
+EM_BOOL onAnimationFrame(double /*time*/, void* user_data) {
+    static_cast<DomBatch*>(user_data)->flush();
+    return EM_FALSE; // one-shot; re-armed on the next queued mutation
+}
+
+} // namespace
+
+DomTokenTable& DomTokenTable::instance() {
+    static DomTokenTable table;
+    return table;
+}
+
+DomToken DomTokenTable::intern(const std::string& name) {
+    auto it = tokens.find(name);
+    if (it != tokens.end()) {
+        return it->second;
+    }
+
+    // Token 0 means "no token"
+    DomToken token = static_cast<DomToken>(tokens.size() + 1);
+    tokens.emplace(name, token);
+    pending.emplace_back(token, name);
+    return token;
+}
+
+std::vector<std::pair<DomToken, std::string>> DomTokenTable::takePending() {
+    return std::move(pending);
+}
+
+DomBatch& DomBatch::instance() {
+    static DomBatch batch;
+    return batch;
+}
+
+void DomBatch::queue(DomMutation::Type type,
+                     const std::string& target,
+                     const std::string& name,
+                     const std::string& value) {
+    if (!enabled) {
+        applyImmediate({type, target, name, value});
+        return;
+    }
+
+    // Style, attribute, innerHTML and property writes are last-write-wins
+    // within a frame; class list ops are order-dependent and appended as-is.
+    bool coalescable = type == DomMutation::Type::SetStyle ||
+                       type == DomMutation::Type::SetAttribute ||
+                       type == DomMutation::Type::RemoveAttribute ||
+                       type == DomMutation::Type::SetInnerHTML ||
+                       type == DomMutation::Type::SetProperty;
+
+    if (coalescable) {
+        std::string slot = target;
+        slot += '\x1f';
+        slot += name;
+        auto it = write_slots.find(slot);
+        if (it != write_slots.end()) {
+            DomMutation& existing = mutations[it->second];
+            existing.type = type;
+            existing.value = value;
+            return;
+        }
+        write_slots.emplace(std::move(slot), mutations.size());
+    }
+
+    mutations.push_back({type, target, name, value});
+    scheduleFlush();
+}
+
+void DomBatch::queueToken(DomMutation::Type type,
+                          const std::string& target,
+                          DomToken name_token,
+                          const std::string& value) {
+    if (!enabled) {
+        applyImmediate({type, target, std::string(), value, name_token});
+        return;
+    }
+
+    bool coalescable = type == DomMutation::Type::SetStyle ||
+                       type == DomMutation::Type::SetAttribute ||
+                       type == DomMutation::Type::RemoveAttribute ||
+                       type == DomMutation::Type::SetProperty;
+
+    if (coalescable) {
+        // '\x10' prefix keeps token slots from colliding with name slots
+        std::string slot = target;
+        slot += '\x1f';
+        slot += '\x10';
+        slot += std::to_string(name_token);
+        auto it = write_slots.find(slot);
+        if (it != write_slots.end()) {
+            DomMutation& existing = mutations[it->second];
+            existing.type = type;
+            existing.value = value;
+            return;
+        }
+        write_slots.emplace(std::move(slot), mutations.size());
+    }
+
+    mutations.push_back({type, target, std::string(), value, name_token});
+    scheduleFlush();
+}
+
+void DomBatch::flush() {
+    flush_scheduled = false;
+    if (mutations.empty()) {
+        return;
+    }
+
+    nlohmann::json ops = nlohmann::json::array();
+    for (const auto& m : mutations) {
+        nlohmann::json op;
+        op["t"] = m.target;
+        op["o"] = static_cast<int>(m.type);
+        if (m.name_token != 0) {
+            op["k"] = m.name_token;
+        } else {
+            op["n"] = m.name;
+        }
+        op["v"] = m.value;
+        ops.push_back(std::move(op));
+    }
+
+    mutations.clear();
+    write_slots.clear();
+
+    nlohmann::json payload;
+    // New tokens ride the same flush that first uses them
+    DomTokenTable& table = DomTokenTable::instance();
+    if (table.hasPending()) {
+        nlohmann::json regs = nlohmann::json::array();
+        for (const auto& [token, name] : table.takePending()) {
+            regs.push_back({token, name});
+        }
+        payload["reg"] = std::move(regs);
+    }
+    payload["ops"] = std::move(ops);
+
+    std::string encoded = payload.dump();
+    DEFIANT_PERF_BOUNDARY_CALL(encoded.size());
+    defiant_apply_dom_mutations(encoded.c_str());
+}
+
+void DomBatch::applyImmediate(const DomMutation& m) {
+    nlohmann::json op;
+    op["t"] = m.target;
+    op["o"] = static_cast<int>(m.type);
+    if (m.name_token != 0) {
+        op["k"] = m.name_token;
+    } else {
+        op["n"] = m.name;
+    }
+    op["v"] = m.value;
+
+    nlohmann::json payload;
+    // A freshly interned token may be crossing for the first time here
+    DomTokenTable& table = DomTokenTable::instance();
+    if (table.hasPending()) {
+        nlohmann::json regs = nlohmann::json::array();
+        for (const auto& [token, name] : table.takePending()) {
+            regs.push_back({token, name});
+        }
+        payload["reg"] = std::move(regs);
+    }
+    payload["ops"] = nlohmann::json::array({std::move(op)});
+
+    std::string encoded = payload.dump();
+    DEFIANT_PERF_BOUNDARY_CALL(encoded.size());
+    defiant_apply_dom_mutations(encoded.c_str());
+}
+
+void DomBatch::setEnabled(bool on) {
+    if (!on) {
+        flush();
+    }
+    enabled = on;
+}
+
+void DomBatch::scheduleFlush() {
+    if (!flush_scheduled) {
+        flush_scheduled = true;
+        emscripten_request_animation_frame(onAnimationFrame, this);
+    }
+}
+
+} // namespace Defiant
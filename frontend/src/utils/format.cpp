@@ -0,0 +1,152 @@
+#include "defiant/utils/format.hpp"
+
+#include <cstring>
+
+namespace Defiant {
+
+namespace {
+
+// "00" "01" ... "99" — two digits per entry, emitted with one table read
+// instead of two divisions
+constexpr char kDigitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// The currencies the dashboard actually sees; linear scan is fine at
+// this size and the descriptor is resolved once per column, not per cell
+constexpr CurrencyDesc kCurrencies[] = {
+    {"USD", "$", 2, 1},
+    {"EUR", "€", 2, 3},
+    {"GBP", "£", 2, 2},
+    {"JPY", "¥", 0, 2},
+    {"CAD", "CA$", 2, 3},
+    {"AUD", "A$", 2, 2},
+    {"CHF", "CHF ", 2, 4},
+    {"SEK", "kr ", 2, 3},
+    {"INR", "₹", 2, 3},
+    {"BRL", "R$", 2, 2},
+};
+
+// Unknown codes fall back to "XXX 12.34"
+constexpr CurrencyDesc kGenericCurrency = {"", "", 2, 0};
+
+// Direct-mapped memo for formatCurrency(): refreshes hit the same few
+// price points over and over, so most calls are a compare and a copy
+struct FormatCacheEntry {
+    int64_t amount = -1;
+    const CurrencyDesc* desc = nullptr;
+    uint8_t length = 0;
+    char text[FormatUtils::kMaxFormatted];
+};
+
+constexpr size_t kFormatCacheSize = 256;  // power of two for masking
+FormatCacheEntry format_cache[kFormatCacheSize];
+
+// Writes the grouped digits of value (value >= 0) and returns the length
+size_t writeGrouped(uint64_t value, char* buf) {
+    // Emit backwards into a scratch buffer, pairs first
+    char scratch[32];
+    size_t n = 0;
+    while (value >= 100) {
+        const char* pair = kDigitPairs + (value % 100) * 2;
+        scratch[n++] = pair[1];
+        scratch[n++] = pair[0];
+        value /= 100;
+    }
+    if (value >= 10) {
+        const char* pair = kDigitPairs + value * 2;
+        scratch[n++] = pair[1];
+        scratch[n++] = pair[0];
+    } else {
+        scratch[n++] = static_cast<char>('0' + value);
+    }
+
+    // Reverse out with thousands separators
+    size_t out = 0;
+    for (size_t i = n; i-- > 0;) {
+        buf[out++] = scratch[i];
+        if (i > 0 && i % 3 == 0) {
+            buf[out++] = ',';
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+const CurrencyDesc& FormatUtils::currencyDesc(std::string_view currency) {
+    for (const CurrencyDesc& desc : kCurrencies) {
+        if (currency == desc.code) {
+            return desc;
+        }
+    }
+    return kGenericCurrency;
+}
+
+size_t FormatUtils::formatCurrencyTo(int64_t amount, const CurrencyDesc& desc,
+                                     char* buf) {
+    size_t out = 0;
+    // Negate in uint64_t: -INT64_MIN overflows int64_t, but its unsigned
+    // magnitude is representable
+    uint64_t value = static_cast<uint64_t>(amount);
+    if (amount < 0) {
+        buf[out++] = '-';
+        value = 0 - value;
+    }
+    std::memcpy(buf + out, desc.symbol, desc.symbol_length);
+    out += desc.symbol_length;
+
+    // Amounts are stored in minor units; split off the fractional part
+    uint64_t fraction = 0;
+    if (desc.decimals == 2) {
+        fraction = value % 100;
+        value /= 100;
+    }
+
+    out += writeGrouped(value, buf + out);
+
+    if (desc.decimals == 2) {
+        const char* pair = kDigitPairs + fraction * 2;
+        buf[out++] = '.';
+        buf[out++] = pair[0];
+        buf[out++] = pair[1];
+    }
+    buf[out] = '\0';
+    return out;
+}
+
+std::string FormatUtils::formatCurrency(int64_t amount,
+                                        const std::string& currency) {
+    const CurrencyDesc& desc = currencyDesc(currency);
+    size_t slot = static_cast<uint64_t>(amount) & (kFormatCacheSize - 1);
+    FormatCacheEntry& entry = format_cache[slot];
+    if (entry.amount == amount && entry.desc == &desc) {
+        return std::string(entry.text, entry.length);
+    }
+
+    char buf[kMaxFormatted];
+    size_t length = formatCurrencyTo(amount, desc, buf);
+    std::string result(buf, length);
+
+    // Unknown currencies bypass the cache: desc identity can't tell two
+    // fallback codes apart
+    if (&desc != &kGenericCurrency) {
+        entry.amount = amount;
+        entry.desc = &desc;
+        entry.length = static_cast<uint8_t>(length);
+        std::memcpy(entry.text, buf, length + 1);
+    } else {
+        result.insert(0, currency + " ");
+    }
+    return result;
+}
+
+} // namespace Defiant
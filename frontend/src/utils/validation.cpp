@@ -0,0 +1,264 @@
+#include "defiant/utils/validation.hpp"
+
+namespace Defiant {
+
+namespace {
+
+bool inBitmap(const std::array<uint64_t, 4>& bitmap, unsigned char c) {
+    return (bitmap[c >> 6] >> (c & 63)) & 1;
+}
+
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+bool isAlpha(char c) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+bool checkLuhn(std::string_view value) {
+    int sum = 0;
+    bool double_next = false;
+    // Walk right to left, skipping the grouping spaces
+    for (size_t i = value.size(); i-- > 0;) {
+        char c = value[i];
+        if (c == ' ') {
+            continue;
+        }
+        if (!isDigit(c)) {
+            return false;
+        }
+        int digit = c - '0';
+        if (double_next) {
+            digit *= 2;
+            if (digit > 9) {
+                digit -= 9;
+            }
+        }
+        sum += digit;
+        double_next = !double_next;
+    }
+    return sum % 10 == 0;
+}
+
+bool checkExpiry(std::string_view value) {
+    // MM/YY or MM/YYYY
+    if (value.size() != 5 && value.size() != 7) {
+        return false;
+    }
+    if (!isDigit(value[0]) || !isDigit(value[1]) || value[2] != '/') {
+        return false;
+    }
+    for (size_t i = 3; i < value.size(); ++i) {
+        if (!isDigit(value[i])) {
+            return false;
+        }
+    }
+    int month = (value[0] - '0') * 10 + (value[1] - '0');
+    return month >= 1 && month <= 12;
+}
+
+bool checkEmailShape(std::string_view value) {
+    size_t at = value.find('@');
+    if (at == 0 || at == std::string_view::npos || at == value.size() - 1) {
+        return false;
+    }
+    if (value.find('@', at + 1) != std::string_view::npos) {
+        return false;
+    }
+    size_t dot = value.rfind('.');
+    if (dot == std::string_view::npos || dot < at + 2 ||
+        dot == value.size() - 1) {
+        return false;
+    }
+    return value.find(' ') == std::string_view::npos;
+}
+
+bool checkIban(std::string_view value) {
+    // Normalized length (spaces dropped) and two-letter country code,
+    // then the ISO 7064 mod-97 checksum computed incrementally
+    char buf[34];
+    size_t n = 0;
+    for (char c : value) {
+        if (c == ' ') {
+            continue;
+        }
+        if (n >= sizeof(buf)) {
+            return false;
+        }
+        if (c >= 'a' && c <= 'z') {
+            c = static_cast<char>(c - 'a' + 'A');
+        }
+        if (!isDigit(c) && !(c >= 'A' && c <= 'Z')) {
+            return false;
+        }
+        buf[n++] = c;
+    }
+    if (n < 15 || !isAlpha(buf[0]) || !isAlpha(buf[1])) {
+        return false;
+    }
+
+    // Rotate the first four chars to the end, fold digits/letters into
+    // the running remainder
+    uint32_t remainder = 0;
+    for (size_t i = 0; i < n; ++i) {
+        char c = buf[(i + 4) % n];
+        if (isDigit(c)) {
+            remainder = (remainder * 10 + static_cast<uint32_t>(c - '0')) % 97;
+        } else {
+            uint32_t code = static_cast<uint32_t>(c - 'A') + 10;
+            remainder = (remainder * 100 + code) % 97;
+        }
+    }
+    return remainder == 1;
+}
+
+} // namespace
+
+CompiledValidator::Builder& CompiledValidator::Builder::charset(
+    const char* allowed, const char* error) {
+    std::array<uint64_t, 4> bitmap = {};
+    for (const char* p = allowed; *p; ++p) {
+        unsigned char c = static_cast<unsigned char>(*p);
+        bitmap[c >> 6] |= uint64_t{1} << (c & 63);
+    }
+    uint16_t index = static_cast<uint16_t>(charsets.size());
+    charsets.push_back(bitmap);
+    program.push_back({VOp::Charset, index, 0, error});
+    return *this;
+}
+
+CompiledValidator::Builder& CompiledValidator::Builder::lengthRange(
+    uint16_t min, uint16_t max, const char* error) {
+    program.push_back({VOp::LengthRange, min, max, error});
+    return *this;
+}
+
+CompiledValidator::Builder& CompiledValidator::Builder::digitCount(
+    uint16_t min, uint16_t max, const char* error) {
+    program.push_back({VOp::DigitCount, min, max, error});
+    return *this;
+}
+
+CompiledValidator::Builder& CompiledValidator::Builder::luhn(
+    const char* error) {
+    program.push_back({VOp::Luhn, 0, 0, error});
+    return *this;
+}
+
+CompiledValidator::Builder& CompiledValidator::Builder::expiry(
+    const char* error) {
+    program.push_back({VOp::Expiry, 0, 0, error});
+    return *this;
+}
+
+CompiledValidator::Builder& CompiledValidator::Builder::emailShape(
+    const char* error) {
+    program.push_back({VOp::EmailShape, 0, 0, error});
+    return *this;
+}
+
+CompiledValidator::Builder& CompiledValidator::Builder::iban(
+    const char* error) {
+    program.push_back({VOp::IbanCheck, 0, 0, error});
+    return *this;
+}
+
+const char* CompiledValidator::run(std::string_view value) const {
+    for (const VInstr& instr : program) {
+        bool ok = true;
+        switch (instr.op) {
+            case VOp::Charset: {
+                const auto& bitmap = charsets[instr.a];
+                for (char c : value) {
+                    if (!inBitmap(bitmap, static_cast<unsigned char>(c))) {
+                        ok = false;
+                        break;
+                    }
+                }
+                break;
+            }
+            case VOp::LengthRange:
+                ok = value.size() >= instr.a && value.size() <= instr.b;
+                break;
+            case VOp::DigitCount: {
+                size_t digits = 0;
+                for (char c : value) {
+                    if (isDigit(c)) {
+                        ++digits;
+                    }
+                }
+                ok = digits >= instr.a && digits <= instr.b;
+                break;
+            }
+            case VOp::Luhn:
+                ok = checkLuhn(value);
+                break;
+            case VOp::Expiry:
+                ok = checkExpiry(value);
+                break;
+            case VOp::EmailShape:
+                ok = checkEmailShape(value);
+                break;
+            case VOp::IbanCheck:
+                ok = checkIban(value);
+                break;
+        }
+        if (!ok) {
+            return instr.error;
+        }
+    }
+    return nullptr;
+}
+
+const CompiledValidator& CompiledValidator::email() {
+    static const CompiledValidator v =
+        Builder()
+            .emailShape("Please enter a valid email address")
+            .compile();
+    return v;
+}
+
+const CompiledValidator& CompiledValidator::cardNumber() {
+    static const CompiledValidator v =
+        Builder()
+            .charset("0123456789 ", "Card number can only contain digits")
+            .digitCount(12, 19, "Please enter a valid card number")
+            .luhn("Please enter a valid card number")
+            .compile();
+    return v;
+}
+
+const CompiledValidator& CompiledValidator::expiryDate() {
+    static const CompiledValidator v =
+        Builder()
+            .expiry("Please enter a valid expiry date (MM/YY)")
+            .compile();
+    return v;
+}
+
+const CompiledValidator& CompiledValidator::cvc() {
+    static const CompiledValidator v =
+        Builder()
+            .charset("0123456789", "CVC can only contain digits")
+            .lengthRange(3, 4, "Please enter a valid CVC")
+            .compile();
+    return v;
+}
+
+const CompiledValidator& CompiledValidator::iban() {
+    static const CompiledValidator v =
+        Builder()
+            .iban("Please enter a valid IBAN")
+            .compile();
+    return v;
+}
+
+const CompiledValidator* CompiledValidator::forInputType(
+    std::string_view type) {
+    if (type == "email") return &email();
+    if (type == "card" || type == "cardnumber") return &cardNumber();
+    if (type == "expiry") return &expiryDate();
+    if (type == "cvc") return &cvc();
+    if (type == "iban") return &iban();
+    return nullptr;
+}
+
+} // namespace Defiant
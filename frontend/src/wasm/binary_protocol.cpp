@@ -0,0 +1,128 @@
+#include "defiant/wasm/binary_protocol.hpp"
+#include <cstring>
+
+namespace Defiant {
+
+namespace {
+
+constexpr const char* kStatusNames[] = {
+    "pending",
+    "processing",
+    "succeeded",
+    "failed",
+    "refunded",
+    "canceled",
+    "unknown",
+};
+
+} // namespace
+
+const char* paymentStatusName(PaymentStatus status) {
+    size_t i = static_cast<size_t>(status);
+    if (i > static_cast<size_t>(PaymentStatus::Unknown)) {
+        i = static_cast<size_t>(PaymentStatus::Unknown);
+    }
+    return kStatusNames[i];
+}
+
+PaymentStatus paymentStatusFromName(std::string_view name) {
+    for (size_t i = 0; i < static_cast<size_t>(PaymentStatus::Unknown); ++i) {
+        if (name == kStatusNames[i]) {
+            return static_cast<PaymentStatus>(i);
+        }
+    }
+    return PaymentStatus::Unknown;
+}
+
+nlohmann::json PaymentEventView::toJson() const {
+    return {
+        {"id", std::string(id)},
+        {"amount", amount},
+        {"currency", std::string(currency)},
+        {"status", paymentStatusName(status)}
+    };
+}
+
+uint8_t BinaryFrameReader::readU8() {
+    if (failed || offset + 1 > length) {
+        failed = true;
+        return 0;
+    }
+    return data[offset++];
+}
+
+uint16_t BinaryFrameReader::readU16() {
+    if (failed || offset + 2 > length) {
+        failed = true;
+        return 0;
+    }
+    uint16_t value;
+    std::memcpy(&value, data + offset, 2);
+    offset += 2;
+    return value;
+}
+
+uint32_t BinaryFrameReader::readU32() {
+    if (failed || offset + 4 > length) {
+        failed = true;
+        return 0;
+    }
+    uint32_t value;
+    std::memcpy(&value, data + offset, 4);
+    offset += 4;
+    return value;
+}
+
+int64_t BinaryFrameReader::readI64() {
+    if (failed || offset + 8 > length) {
+        failed = true;
+        return 0;
+    }
+    int64_t value;
+    std::memcpy(&value, data + offset, 8);
+    offset += 8;
+    return value;
+}
+
+std::string_view BinaryFrameReader::readString16() {
+    uint16_t len = readU16();
+    if (failed || offset + len > length) {
+        failed = true;
+        return {};
+    }
+    std::string_view view(reinterpret_cast<const char*>(data + offset), len);
+    offset += len;
+    return view;
+}
+
+bool parseBinaryFrame(const uint8_t* data, size_t length, BinaryFrame& frame) {
+    if (!isBinaryFrame(data, length)) {
+        return false;
+    }
+
+    BinaryFrameReader reader(data, length);
+    reader.readU8(); // magic
+    reader.readU8(); // version
+
+    uint8_t type = reader.readU8();
+    uint8_t status = reader.readU8();
+    int64_t amount = reader.readI64();
+    std::string_view id = reader.readString16();
+    std::string_view currency = reader.readString16();
+
+    if (!reader.ok() || type >= static_cast<uint8_t>(EventType::Count)) {
+        return false;
+    }
+
+    frame.type = static_cast<EventType>(type);
+    frame.payment.id = id;
+    frame.payment.amount = amount;
+    frame.payment.currency = currency;
+    frame.payment.status =
+        status <= static_cast<uint8_t>(PaymentStatus::Unknown)
+            ? static_cast<PaymentStatus>(status)
+            : PaymentStatus::Unknown;
+    return true;
+}
+
+} // namespace Defiant
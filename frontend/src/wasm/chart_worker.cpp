@@ -0,0 +1,170 @@
+#include "defiant/wasm/chart_worker.hpp"
+#include "defiant/wasm/ring_buffer.hpp"
+
+#include <emscripten.h>
+#include <emscripten/threading.h>
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace Defiant {
+
+namespace {
+
+struct Job {
+    std::vector<double> values;
+    size_t target_points;
+    ChartWorkerPool::ResultCallback callback;
+};
+
+struct Delivery {
+    ChartWorkerPool::ResultCallback callback;
+    ChartVertexBuffer buffer;
+};
+
+std::mutex queue_mutex;
+std::condition_variable queue_cv;
+std::deque<Job> job_queue;
+bool worker_started = false;
+
+// Runs on the main thread via the proxying queue
+extern "C" void deliverChartBuffer(void* arg) {
+    Delivery* delivery = static_cast<Delivery*>(arg);
+    delivery->callback(std::move(delivery->buffer));
+    delete delivery;
+}
+
+void workerLoop() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            queue_cv.wait(lock, [] { return !job_queue.empty(); });
+            job = std::move(job_queue.front());
+            job_queue.pop_front();
+        }
+
+        auto* delivery = new Delivery{
+            std::move(job.callback),
+            ChartWorkerPool::downsample(job.values, job.target_points)
+        };
+
+        // Hand the pointer to the main thread over the shared ring; the
+        // rAF drain picks it up next frame. The proxying queue stays as
+        // the fallback when the ring is momentarily full.
+        if (!WorkerTransport::instance().publish(RingMessage::ChartVertices,
+                                                 &delivery,
+                                                 sizeof(delivery))) {
+            emscripten_async_run_in_main_runtime_thread(
+                EM_FUNC_SIG_VI, reinterpret_cast<void*>(&deliverChartBuffer),
+                delivery);
+        }
+    }
+}
+
+} // namespace
+
+ChartWorkerPool::ChartWorkerPool() = default;
+
+ChartWorkerPool& ChartWorkerPool::instance() {
+    static ChartWorkerPool pool;
+    return pool;
+}
+
+void ChartWorkerPool::prepare(std::vector<double> values,
+                              size_t target_points,
+                              ResultCallback callback) {
+#ifdef __EMSCRIPTEN_PTHREADS__
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        if (!worker_started) {
+            worker_started = true;
+            // prepare() runs on the main thread, so this is the right
+            // moment to claim the chart tag on the transport
+            WorkerTransport::instance().onMessage(
+                RingMessage::ChartVertices,
+                [](const uint8_t* payload, size_t) {
+                    Delivery* delivery;
+                    std::memcpy(&delivery, payload, sizeof(delivery));
+                    deliverChartBuffer(delivery);
+                });
+            std::thread(workerLoop).detach();
+        }
+        job_queue.push_back({std::move(values), target_points, std::move(callback)});
+    }
+    queue_cv.notify_one();
+#else
+    // No thread pool in this build: compute inline
+    callback(downsample(values, target_points));
+#endif
+}
+
+ChartVertexBuffer ChartWorkerPool::downsample(const std::vector<double>& values,
+                                              size_t target_points) {
+    ChartVertexBuffer buffer;
+    buffer.source_points = values.size();
+
+    if (values.empty() || target_points == 0) {
+        return buffer;
+    }
+
+    buffer.min_value = values[0];
+    buffer.max_value = values[0];
+
+    if (values.size() <= target_points) {
+        // Small series: pass through unchanged
+        buffer.vertices.reserve(values.size() * 2);
+        double denom = values.size() > 1 ? double(values.size() - 1) : 1.0;
+        for (size_t i = 0; i < values.size(); ++i) {
+            buffer.min_value = std::min(buffer.min_value, values[i]);
+            buffer.max_value = std::max(buffer.max_value, values[i]);
+            buffer.vertices.push_back(static_cast<float>(i / denom));
+            buffer.vertices.push_back(static_cast<float>(values[i]));
+        }
+        return buffer;
+    }
+
+    // Min-max binning: each bin contributes its extremes in encounter
+    // order, preserving the visual envelope of the series
+    buffer.vertices.reserve(target_points * 4);
+    double bin_width = double(values.size()) / double(target_points);
+
+    for (size_t bin = 0; bin < target_points; ++bin) {
+        size_t start = static_cast<size_t>(bin * bin_width);
+        size_t end = std::min(static_cast<size_t>((bin + 1) * bin_width) + 1,
+                              values.size());
+
+        double bin_min = values[start];
+        double bin_max = values[start];
+        size_t min_idx = start;
+        size_t max_idx = start;
+
+        for (size_t i = start + 1; i < end; ++i) {
+            if (values[i] < bin_min) { bin_min = values[i]; min_idx = i; }
+            if (values[i] > bin_max) { bin_max = values[i]; max_idx = i; }
+        }
+
+        buffer.min_value = std::min(buffer.min_value, bin_min);
+        buffer.max_value = std::max(buffer.max_value, bin_max);
+
+        float x_first = static_cast<float>(std::min(min_idx, max_idx)) /
+                        float(values.size() - 1);
+        float x_second = static_cast<float>(std::max(min_idx, max_idx)) /
+                         float(values.size() - 1);
+        double y_first = min_idx <= max_idx ? bin_min : bin_max;
+        double y_second = min_idx <= max_idx ? bin_max : bin_min;
+
+        buffer.vertices.push_back(x_first);
+        buffer.vertices.push_back(static_cast<float>(y_first));
+        buffer.vertices.push_back(x_second);
+        buffer.vertices.push_back(static_cast<float>(y_second));
+    }
+
+    return buffer;
+}
+
+} // namespace Defiant
@@ -0,0 +1,152 @@
+#include "defiant/wasm/request_batcher.hpp"
+
+#include <emscripten.h>
+#include <emscripten/fetch.h>
+#include <cstring>
+#include <utility>
+
+namespace Defiant {
+
+void BatchFuture::resolve(BatchResult result) {
+    state->result = std::move(result);
+    state->ready = true;
+    for (const auto& callback : state->callbacks) {
+        callback(state->result);
+    }
+    state->callbacks.clear();
+}
+
+void BatchFuture::then(std::function<void(const BatchResult&)> callback) {
+    if (state->ready) {
+        callback(state->result);
+    } else {
+        state->callbacks.push_back(std::move(callback));
+    }
+}
+
+namespace {
+
+// Heap context keeping the request body and the futures alive for the
+// duration of the fetch
+struct BatchContext {
+    std::string payload;
+    std::string auth_header;
+    std::vector<BatchFuture> futures;
+};
+
+void resolveAll(BatchContext* context, int status, const nlohmann::json& body) {
+    for (auto& future : context->futures) {
+        future.resolve({status, body});
+    }
+    delete context;
+}
+
+void onBatchSuccess(emscripten_fetch_t* fetch) {
+    auto* context = static_cast<BatchContext*>(fetch->userData);
+
+    nlohmann::json parsed;
+    try {
+        parsed = nlohmann::json::parse(fetch->data, fetch->data + fetch->numBytes);
+    } catch (const nlohmann::json::exception&) {
+        resolveAll(context, 502, {{"error", "invalid batch response"}});
+        emscripten_fetch_close(fetch);
+        return;
+    }
+
+    // Responses come back in submission order
+    const nlohmann::json& responses = parsed["responses"];
+    for (size_t i = 0; i < context->futures.size(); ++i) {
+        if (responses.is_array() && i < responses.size()) {
+            const nlohmann::json& entry = responses[i];
+            context->futures[i].resolve({
+                entry.value("status", 200),
+                entry.contains("body") ? entry["body"] : nlohmann::json()
+            });
+        } else {
+            context->futures[i].resolve({502, {{"error", "missing batch entry"}}});
+        }
+    }
+
+    delete context;
+    emscripten_fetch_close(fetch);
+}
+
+void onBatchError(emscripten_fetch_t* fetch) {
+    auto* context = static_cast<BatchContext*>(fetch->userData);
+    resolveAll(context, fetch->status != 0 ? fetch->status : 0,
+               {{"error", "batch request failed"}});
+    emscripten_fetch_close(fetch);
+}
+
+} // namespace
+
+RequestBatcher::RequestBatcher(std::string base_url, std::string api_key)
+    : base_url(std::move(base_url)), api_key(std::move(api_key)) {}
+
+BatchFuture RequestBatcher::request(const std::string& method,
+                                    const std::string& path,
+                                    const nlohmann::json& body) {
+    BatchFuture future;
+    pending.push_back({method, path, body, future});
+    scheduleFlush();
+    return future;
+}
+
+void RequestBatcher::scheduleFlush() {
+    if (!flush_scheduled) {
+        flush_scheduled = true;
+        // Zero-delay: runs after the current tick, so everything queued by
+        // the same render pass rides in one batch
+        emscripten_async_call(&RequestBatcher::onFlushTick, this, 0);
+    }
+}
+
+void RequestBatcher::onFlushTick(void* user_data) {
+    auto* self = static_cast<RequestBatcher*>(user_data);
+    self->flush_scheduled = false;
+    self->flush();
+}
+
+void RequestBatcher::flush() {
+    if (pending.empty()) {
+        return;
+    }
+
+    nlohmann::json requests = nlohmann::json::array();
+    auto* context = new BatchContext();
+
+    for (auto& entry : pending) {
+        requests.push_back({
+            {"method", entry.method},
+            {"path", entry.path},
+            {"body", entry.body}
+        });
+        context->futures.push_back(entry.future);
+    }
+    pending.clear();
+
+    context->payload = nlohmann::json{{"requests", requests}}.dump();
+    context->auth_header = "Bearer " + api_key;
+
+    emscripten_fetch_attr_t attr;
+    emscripten_fetch_attr_init(&attr);
+    std::strcpy(attr.requestMethod, "POST");
+    attr.attributes = EMSCRIPTEN_FETCH_LOAD_TO_MEMORY;
+    attr.userData = context;
+    attr.onsuccess = onBatchSuccess;
+    attr.onerror = onBatchError;
+    attr.requestData = context->payload.c_str();
+    attr.requestDataSize = context->payload.size();
+
+    const char* request_headers[] = {
+        "Content-Type", "application/json",
+        "Authorization", context->auth_header.c_str(),
+        nullptr
+    };
+    attr.requestHeaders = request_headers;
+
+    std::string url = base_url + "/v1/batch";
+    emscripten_fetch(&attr, url.c_str());
+}
+
+} // namespace Defiant
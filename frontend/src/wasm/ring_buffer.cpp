@@ -0,0 +1,148 @@
+#include "defiant/wasm/ring_buffer.hpp"
+
+#include <cstring>
+#include <utility>
+
+namespace Defiant {
+
+namespace {
+
+size_t roundUpPowerOfTwo(size_t n) {
+    size_t p = 1;
+    while (p < n) {
+        p <<= 1;
+    }
+    return p;
+}
+
+} // namespace
+
+MpscRing::MpscRing(size_t capacity)
+    : capacity_(roundUpPowerOfTwo(capacity < 2 ? 2 : capacity)),
+      mask_(capacity_ - 1) {
+    slots_ = std::make_unique<Slot[]>(capacity_);
+    // A slot is free for position p when sequence == p
+    for (size_t i = 0; i < capacity_; ++i) {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+MpscRing::~MpscRing() {
+    // Free spill blocks for messages that were never consumed
+    drain([](uint32_t, const uint8_t*, size_t) {}, capacity_);
+}
+
+MpscRing::Slot* MpscRing::claimSlot(uint64_t& pos) {
+    pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot& slot = slots_[pos & mask_];
+        uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+        intptr_t diff =
+            static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            // Slot is free; race other producers for it
+            if (enqueue_pos_.compare_exchange_weak(
+                    pos, pos + 1, std::memory_order_relaxed)) {
+                return &slot;
+            }
+        } else if (diff < 0) {
+            // Consumer hasn't released this slot yet — ring is full
+            return nullptr;
+        } else {
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool MpscRing::tryPublish(uint32_t tag, const void* data, size_t size) {
+    if (size > kInlinePayload) {
+        auto* block = new uint8_t[size];
+        std::memcpy(block, data, size);
+        return tryPublishOwned(tag, block, size);
+    }
+
+    uint64_t pos;
+    Slot* slot = claimSlot(pos);
+    if (!slot) {
+        return false;
+    }
+    slot->tag = tag;
+    slot->size = static_cast<uint32_t>(size);
+    slot->spill = nullptr;
+    std::memcpy(slot->inline_payload, data, size);
+    // Publish: sequence == pos + 1 marks the slot ready to consume
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool MpscRing::tryPublishOwned(uint32_t tag, uint8_t* block, size_t size) {
+    uint64_t pos;
+    Slot* slot = claimSlot(pos);
+    if (!slot) {
+        delete[] block;
+        return false;
+    }
+    slot->tag = tag;
+    slot->size = static_cast<uint32_t>(size);
+    slot->spill = block;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+size_t MpscRing::drain(const MessageFn& fn, size_t max_messages) {
+    size_t consumed = 0;
+    while (consumed < max_messages) {
+        Slot& slot = slots_[dequeue_pos_ & mask_];
+        uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+        if (seq != dequeue_pos_ + 1) {
+            break;  // next slot not published yet
+        }
+        const uint8_t* payload =
+            slot.spill ? slot.spill : slot.inline_payload;
+        fn(slot.tag, payload, slot.size);
+        delete[] slot.spill;
+        slot.spill = nullptr;
+        // Release: sequence == pos + capacity marks it free for the
+        // producer that wraps around to it
+        slot.sequence.store(dequeue_pos_ + capacity_,
+                            std::memory_order_release);
+        ++dequeue_pos_;
+        ++consumed;
+    }
+    return consumed;
+}
+
+// ====== WorkerTransport ======
+
+WorkerTransport::WorkerTransport() : ring_(1024) {}
+
+WorkerTransport& WorkerTransport::instance() {
+    static WorkerTransport transport;
+    return transport;
+}
+
+void WorkerTransport::onMessage(uint32_t tag, Handler handler) {
+    handlers_[tag] = std::move(handler);
+}
+
+bool WorkerTransport::publish(uint32_t tag, const void* data, size_t size) {
+    return ring_.tryPublish(tag, data, size);
+}
+
+bool WorkerTransport::publishOwned(uint32_t tag, uint8_t* block,
+                                   size_t size) {
+    return ring_.tryPublishOwned(tag, block, size);
+}
+
+size_t WorkerTransport::drain(size_t max_messages) {
+    return ring_.drain(
+        [this](uint32_t tag, const uint8_t* payload, size_t size) {
+            auto it = handlers_.find(tag);
+            if (it != handlers_.end()) {
+                it->second(payload, size);
+            }
+        },
+        max_messages);
+}
+
+} // namespace Defiant
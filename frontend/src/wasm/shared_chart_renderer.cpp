@@ -0,0 +1,277 @@
+#include "defiant/wasm/shared_chart_renderer.hpp"
+
+#include <emscripten.h>
+#include <algorithm>
+#include <cstring>
+
+// Nothing in the host page is required to provide the shared canvas: if
+// the selector matches nothing, mint a full-viewport overlay (pointer
+// events pass through to the UI underneath) and keep its backing store
+// sized to the window. Only id selectors can be minted.
+EM_JS(void, defiant_shared_canvas_ensure, (const char* selector_ptr), {
+    var selector = UTF8ToString(selector_ptr);
+    if (document.querySelector(selector) || selector.charAt(0) !== '#') {
+        return;
+    }
+    var canvas = document.createElement('canvas');
+    canvas.id = selector.slice(1);
+    canvas.width = window.innerWidth;
+    canvas.height = window.innerHeight;
+    canvas.style.position = 'fixed';
+    canvas.style.left = '0';
+    canvas.style.top = '0';
+    canvas.style.width = '100%';
+    canvas.style.height = '100%';
+    canvas.style.pointerEvents = 'none';
+    document.body.appendChild(canvas);
+    window.addEventListener('resize', function() {
+        canvas.width = window.innerWidth;
+        canvas.height = window.innerHeight;
+    });
+});
+
+namespace Defiant {
+
+namespace {
+
+const char* kVertexShader = R"(#version 300 es
+layout(location = 0) in vec2 position;
+uniform vec2 u_y_range; // (min, max)
+void main() {
+    float x = position.x * 2.0 - 1.0;
+    float span = max(u_y_range.y - u_y_range.x, 1e-6);
+    float y = (position.y - u_y_range.x) / span * 2.0 - 1.0;
+    gl_Position = vec4(x, y, 0.0, 1.0);
+})";
+
+const char* kFragmentShader = R"(#version 300 es
+precision mediump float;
+uniform vec4 u_color;
+out vec4 fragColor;
+void main() {
+    fragColor = u_color;
+})";
+
+EM_BOOL onSharedRenderFrame(double /*time*/, void* user_data) {
+    static_cast<SharedChartRenderer*>(user_data)->renderAll();
+    return EM_FALSE;
+}
+
+} // namespace
+
+SharedChartRenderer& SharedChartRenderer::instance() {
+    static SharedChartRenderer renderer;
+    return renderer;
+}
+
+bool SharedChartRenderer::initialize(const char* canvas_selector) {
+    if (context != 0) {
+        return true;
+    }
+
+    defiant_shared_canvas_ensure(canvas_selector);
+
+    EmscriptenWebGLContextAttributes attrs;
+    emscripten_webgl_init_context_attributes(&attrs);
+    attrs.majorVersion = 2;
+    attrs.antialias = true;
+
+    context = emscripten_webgl_create_context(canvas_selector, &attrs);
+    if (context <= 0) {
+        context = 0;
+        return false;
+    }
+
+    emscripten_webgl_make_context_current(context);
+
+    if (!compileProgram()) {
+        return false;
+    }
+
+    glGenBuffers(1, &vbo);
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+
+    return true;
+}
+
+int SharedChartRenderer::registerChart(const std::string& chart_id) {
+    if (context == 0 && !initialize()) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < slots.size(); ++i) {
+        if (!slots[i].in_use) {
+            slots[i] = Slot{};
+            slots[i].in_use = true;
+            slots[i].chart_id = chart_id;
+            return static_cast<int>(i);
+        }
+    }
+
+    Slot slot;
+    slot.in_use = true;
+    slot.chart_id = chart_id;
+    slots.push_back(std::move(slot));
+    return static_cast<int>(slots.size() - 1);
+}
+
+void SharedChartRenderer::unregisterChart(int handle) {
+    if (handle < 0 || static_cast<size_t>(handle) >= slots.size()) {
+        return;
+    }
+    slots[handle].in_use = false;
+    slots[handle].vertices.clear();
+    slots[handle].float_count = 0;
+    buffer_dirty = true;
+    scheduleRender();
+}
+
+void SharedChartRenderer::updateGeometry(int handle,
+                                         const ChartVertexBuffer& buffer,
+                                         int x, int y, int width, int height) {
+    if (handle < 0 || static_cast<size_t>(handle) >= slots.size() ||
+        !slots[handle].in_use) {
+        return;
+    }
+
+    Slot& slot = slots[handle];
+    slot.x = x;
+    slot.y = y;
+    slot.width = width;
+    slot.height = height;
+    slot.min_value = static_cast<float>(buffer.min_value);
+    slot.max_value = static_cast<float>(buffer.max_value);
+
+    // Geometry sizes change between updates, so buffer ranges are fixed up
+    // by rebuildVertexData; the GL upload stays a single glBufferData
+    slot.vertices = buffer.vertices;
+    slot.float_count = slot.vertices.size();
+    slot.first_float = 0;
+
+    buffer_dirty = true;
+    scheduleRender();
+}
+
+void SharedChartRenderer::setColor(int handle, float r, float g, float b, float a) {
+    if (handle < 0 || static_cast<size_t>(handle) >= slots.size()) {
+        return;
+    }
+    slots[handle].color[0] = r;
+    slots[handle].color[1] = g;
+    slots[handle].color[2] = b;
+    slots[handle].color[3] = a;
+    scheduleRender();
+}
+
+void SharedChartRenderer::renderAll() {
+    render_scheduled = false;
+    if (context == 0) {
+        return;
+    }
+
+    emscripten_webgl_make_context_current(context);
+
+    if (buffer_dirty) {
+        rebuildVertexData();
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER,
+                     vertex_data.size() * sizeof(float),
+                     vertex_data.data(),
+                     GL_DYNAMIC_DRAW);
+        buffer_dirty = false;
+    }
+
+    glUseProgram(program);
+    glBindVertexArray(vao);
+    glEnable(GL_SCISSOR_TEST);
+
+    for (const Slot& slot : slots) {
+        if (!slot.in_use || slot.float_count < 4) {
+            continue;
+        }
+
+        glViewport(slot.x, slot.y, slot.width, slot.height);
+        glScissor(slot.x, slot.y, slot.width, slot.height);
+        glUniform2f(uniform_y_range, slot.min_value, slot.max_value);
+        glUniform4fv(uniform_color, 1, slot.color);
+        glDrawArrays(GL_LINE_STRIP,
+                     static_cast<GLint>(slot.first_float / 2),
+                     static_cast<GLsizei>(slot.float_count / 2));
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+}
+
+size_t SharedChartRenderer::chartCount() const {
+    size_t count = 0;
+    for (const Slot& slot : slots) {
+        if (slot.in_use) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void SharedChartRenderer::scheduleRender() {
+    if (!render_scheduled) {
+        render_scheduled = true;
+        emscripten_request_animation_frame(onSharedRenderFrame, this);
+    }
+}
+
+void SharedChartRenderer::rebuildVertexData() {
+    vertex_data.clear();
+    for (Slot& slot : slots) {
+        if (!slot.in_use) {
+            continue;
+        }
+        slot.first_float = vertex_data.size();
+        slot.float_count = slot.vertices.size();
+        vertex_data.insert(vertex_data.end(),
+                           slot.vertices.begin(), slot.vertices.end());
+    }
+}
+
+bool SharedChartRenderer::compileProgram() {
+    auto compile = [](GLenum type, const char* source) -> GLuint {
+        GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 1, &source, nullptr);
+        glCompileShader(shader);
+        GLint ok = GL_FALSE;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+        if (!ok) {
+            glDeleteShader(shader);
+            return 0;
+        }
+        return shader;
+    };
+
+    GLuint vs = compile(GL_VERTEX_SHADER, kVertexShader);
+    GLuint fs = compile(GL_FRAGMENT_SHADER, kFragmentShader);
+    if (!vs || !fs) {
+        return false;
+    }
+
+    program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    GLint ok = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok) {
+        return false;
+    }
+
+    uniform_y_range = glGetUniformLocation(program, "u_y_range");
+    uniform_color = glGetUniformLocation(program, "u_color");
+    return true;
+}
+
+} // namespace Defiant
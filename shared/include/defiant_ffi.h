@@ -59,6 +59,58 @@ typedef struct {
 void defiant_init(const char* config_path, DefiantError* error);
 void defiant_cleanup();
 
+// ==================== Client Handle API ====================
+// A client owns everything the per-call entry points rebuild on every
+// invocation: the async runtime, the pooled database and Redis
+// connections (keep-alive, reused across calls), the service objects
+// and the authenticated api_key. Batch jobs create one client and issue
+// millions of calls through it; the global defiant_init must have run
+// first. Handles are not thread-safe; create one per calling thread.
+typedef struct DefiantClient DefiantClient;
+
+typedef struct {
+    // Worker threads for the client's async runtime; 0 picks the
+    // runtime default
+    int32_t worker_threads;
+} DefiantClientOptions;
+
+DefiantClient* defiant_client_new(
+    const char* api_key,
+    const DefiantClientOptions* options,
+    DefiantError* error
+);
+
+void defiant_client_free(DefiantClient* client);
+
+// _with_client variants of the payment/customer entry points; identical
+// semantics minus the per-call api_key and setup cost
+DefiantPayment* defiant_create_payment_with_client(
+    DefiantClient* client,
+    int64_t amount,
+    const char* currency,
+    const char* payment_method,
+    const char* customer_id,
+    const char* description,
+    const char* metadata,
+    DefiantError* error
+);
+
+DefiantPayment* defiant_get_payment_with_client(
+    DefiantClient* client,
+    const char* payment_id,
+    DefiantError* error
+);
+
+DefiantCustomer* defiant_create_customer_with_client(
+    DefiantClient* client,
+    const char* email,
+    const char* name,
+    const char* phone,
+    const char* description,
+    const char* metadata,
+    DefiantError* error
+);
+
 // ==================== Payment API ====================
 DefiantPayment* defiant_create_payment(
     const char* api_key,
@@ -149,6 +201,41 @@ char* defiant_process_webhook(
     DefiantError* error
 );
 
+// Batch verification for webhook backlog replay. payloads[i] is
+// payload_lengths[i] bytes (not NUL-terminated); signature_headers[i] is
+// the corresponding signature header string. Verification fans out over
+// an internal thread pool. result_bitmap must hold (count + 63) / 64
+// uint64_t words; bit i is set when pair i verified. Returns the number
+// of valid pairs, or SIZE_MAX with *error set on malformed input.
+size_t defiant_verify_webhook_batch(
+    const char* const* payloads,
+    const size_t* payload_lengths,
+    const char* const* signature_headers,
+    size_t count,
+    const char* webhook_secret,
+    uint64_t* result_bitmap,
+    DefiantError* error
+);
+
+// Streaming verification for payloads too large (or too fragmented) to
+// present as one contiguous buffer: feed chunks in order, then verify.
+// defiant_webhook_verifier_finish frees the context in all cases.
+typedef struct DefiantWebhookVerifier DefiantWebhookVerifier;
+
+DefiantWebhookVerifier* defiant_webhook_verifier_new(
+    const char* webhook_secret,
+    const char* signature_header,
+    DefiantError* error
+);
+
+void defiant_webhook_verifier_update(
+    DefiantWebhookVerifier* verifier,
+    const uint8_t* data,
+    size_t length
+);
+
+bool defiant_webhook_verifier_finish(DefiantWebhookVerifier* verifier);
+
 // ==================== Crypto API ====================
 char* defiant_generate_crypto_address(
     const char* currency,
@@ -193,6 +280,58 @@ char* defiant_decrypt_data(
     DefiantError* error
 );
 
+// ==================== Borrowed View API ====================
+// Zero-copy variant of the list API: every string is a length-prefixed
+// view pointing into one response buffer owned by the returned object.
+// A 10k-payment list marshals with one backing allocation instead of ten
+// heap strings per record, and is released with a single
+// defiant_free_response call. Views are valid until that call.
+typedef struct {
+    const char* data; // NOT NUL-terminated
+    uint32_t len;
+} DefiantStrView;
+
+typedef struct {
+    DefiantStrView id;
+    int64_t amount;
+    DefiantStrView currency;
+    DefiantStrView status;
+    DefiantStrView payment_method;
+    DefiantStrView customer_id;
+    DefiantStrView description;
+    DefiantStrView metadata;
+    DefiantStrView created_at;
+    DefiantStrView client_secret;
+} DefiantPaymentView;
+
+typedef struct {
+    const DefiantPaymentView* payments;
+    size_t count;
+    bool has_more;
+    int64_t total;
+    void* buffer; // opaque backing storage; do not touch
+} DefiantPaymentListView;
+
+DefiantPaymentListView* defiant_list_payments_view(
+    const char* api_key,
+    const char* cursor,
+    int limit,
+    const char* customer_id,
+    const char* status,
+    DefiantError* error
+);
+
+DefiantPaymentListView* defiant_list_payments_view_with_client(
+    DefiantClient* client,
+    const char* cursor,
+    int limit,
+    const char* customer_id,
+    const char* status,
+    DefiantError* error
+);
+
+void defiant_free_response(DefiantPaymentListView* response);
+
 // ==================== Memory Management ====================
 void defiant_free_payment(DefiantPayment* payment);
 void defiant_free_customer(DefiantCustomer* customer);
@@ -218,6 +357,40 @@ bool defiant_stream_events(
     DefiantError* error
 );
 
+// ==================== Columnar Streaming API ====================
+// Bulk-export variant of defiant_stream_payments: records are delivered
+// in chunks as parallel typed arrays instead of one callback per record,
+// so a reconciliation pass over millions of payments runs tight loops
+// over contiguous columns rather than paying callback + string-parse
+// overhead per row. String columns are Arrow-style: concatenated UTF-8
+// data plus count+1 offsets, value i = data + offsets[i] with length
+// offsets[i+1] - offsets[i]. Chunk buffers are owned by the library and
+// valid only for the duration of the callback; copy what you keep.
+typedef struct {
+    const char* data;        // concatenated values, NOT NUL-terminated
+    const uint32_t* offsets; // count + 1 entries
+} DefiantStrColumn;
+
+typedef struct {
+    size_t count;
+    const int64_t* amounts;
+    DefiantStrColumn ids;
+    DefiantStrColumn currencies;
+    DefiantStrColumn statuses;
+    DefiantStrColumn customer_ids;
+    DefiantStrColumn created_ats;
+} DefiantPaymentChunk;
+
+typedef void (*DefiantChunkCallback)(const DefiantPaymentChunk* chunk, void* user_data);
+
+bool defiant_stream_payments_batched(
+    const char* api_key,
+    size_t chunk_size,
+    DefiantChunkCallback callback,
+    void* user_data,
+    DefiantError* error
+);
+
 // ==================== Analytics API ====================
 typedef struct {
     int64_t total_amount;
@@ -239,6 +412,21 @@ DefiantAnalyticsSummary* defiant_get_analytics(
 
 void defiant_free_analytics(DefiantAnalyticsSummary* analytics);
 
+// Incremental mode: take one defiant_get_analytics snapshot, then fold
+// per-event aggregate deltas into it locally instead of re-requesting
+// the summary. Deltas are "analytics.delta" events whose data is a JSON
+// object of counter changes (total_amount, total_count,
+// successful_count, failed_count, refunded_amount). Equivalent to
+// defiant_stream_events with that event type. Blocks the calling thread
+// for the life of the stream; call it from a dedicated thread. Returns
+// false with *error set when setup or the stream itself fails.
+bool defiant_stream_analytics_deltas(
+    const char* api_key,
+    DefiantStreamCallback callback,
+    void* user_data,
+    DefiantError* error
+);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
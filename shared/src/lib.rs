@@ -128,6 +128,224 @@ pub struct CDefiantPaymentList {
     pub url: *mut c_char,
 }
 
+// ==================== Borrowed View API ====================
+
+#[repr(C)]
+pub struct CDefiantStrView {
+    pub data: *const c_char,
+    pub len: u32,
+}
+
+#[repr(C)]
+pub struct CDefiantPaymentView {
+    pub id: CDefiantStrView,
+    pub amount: int64_t,
+    pub currency: CDefiantStrView,
+    pub status: CDefiantStrView,
+    pub payment_method: CDefiantStrView,
+    pub customer_id: CDefiantStrView,
+    pub description: CDefiantStrView,
+    pub metadata: CDefiantStrView,
+    pub created_at: CDefiantStrView,
+    pub client_secret: CDefiantStrView,
+}
+
+#[repr(C)]
+pub struct CDefiantPaymentListView {
+    pub payments: *const CDefiantPaymentView,
+    pub count: size_t,
+    pub has_more: bool,
+    pub total: int64_t,
+    pub buffer: *mut c_void,
+}
+
+// Backing storage for one response: all strings live contiguously in
+// `text`, views index into it. One allocation per list instead of ten
+// heap strings per record; freed in one call.
+struct ResponseBuffer {
+    text: String,
+    views: Vec<CDefiantPaymentView>,
+}
+
+// Offsets recorded while building (String may reallocate during pushes;
+// pointers are fixed up once the buffer is final)
+#[derive(Clone, Copy, Default)]
+struct Span {
+    offset: usize,
+    len: usize,
+}
+
+fn push_span(text: &mut String, value: &str) -> Span {
+    let offset = text.len();
+    text.push_str(value);
+    Span { offset, len: value.len() }
+}
+
+fn span_view(base: *const c_char, span: Span) -> CDefiantStrView {
+    CDefiantStrView {
+        data: unsafe { base.add(span.offset) },
+        len: span.len as u32,
+    }
+}
+
+fn build_payment_list_view(
+    payments: Vec<PaymentResponse>,
+    has_more: bool,
+    total: i64,
+) -> *mut CDefiantPaymentListView {
+    struct Spans {
+        id: Span,
+        currency: Span,
+        status: Span,
+        payment_method: Span,
+        customer_id: Span,
+        description: Span,
+        metadata: Span,
+        created_at: Span,
+        client_secret: Span,
+        amount: i64,
+    }
+
+    let mut text = String::new();
+    let mut spans: Vec<Spans> = Vec::with_capacity(payments.len());
+
+    for payment in &payments {
+        spans.push(Spans {
+            id: push_span(&mut text, &payment.id.to_string()),
+            currency: push_span(&mut text, &payment.currency),
+            status: push_span(&mut text, &payment.status.to_string()),
+            payment_method: push_span(&mut text, &payment.payment_method.to_string()),
+            customer_id: payment
+                .customer_id
+                .map(|id| push_span(&mut text, &id.to_string()))
+                .unwrap_or_default(),
+            description: payment
+                .description
+                .as_deref()
+                .map(|d| push_span(&mut text, d))
+                .unwrap_or_default(),
+            metadata: payment
+                .metadata
+                .as_ref()
+                .map(|m| push_span(&mut text, &m.to_string()))
+                .unwrap_or_default(),
+            created_at: push_span(&mut text, &payment.created_at.to_rfc3339()),
+            client_secret: payment
+                .client_secret
+                .as_deref()
+                .map(|s| push_span(&mut text, s))
+                .unwrap_or_default(),
+            amount: payment.amount,
+        });
+    }
+
+    let mut buffer = Box::new(ResponseBuffer {
+        text,
+        views: Vec::with_capacity(spans.len()),
+    });
+
+    // The String's heap block is stable now; resolve spans to pointers
+    let base = buffer.text.as_ptr() as *const c_char;
+    for s in &spans {
+        buffer.views.push(CDefiantPaymentView {
+            id: span_view(base, s.id),
+            amount: s.amount,
+            currency: span_view(base, s.currency),
+            status: span_view(base, s.status),
+            payment_method: span_view(base, s.payment_method),
+            customer_id: span_view(base, s.customer_id),
+            description: span_view(base, s.description),
+            metadata: span_view(base, s.metadata),
+            created_at: span_view(base, s.created_at),
+            client_secret: span_view(base, s.client_secret),
+        });
+    }
+
+    let list = CDefiantPaymentListView {
+        payments: buffer.views.as_ptr(),
+        count: buffer.views.len() as size_t,
+        has_more,
+        total,
+        buffer: Box::into_raw(buffer) as *mut c_void,
+    };
+
+    Box::into_raw(Box::new(list))
+}
+
+#[no_mangle]
+pub extern "C" fn defiant_list_payments_view(
+    api_key: *const c_char,
+    cursor: *const c_char,
+    limit: c_int,
+    customer_id: *const c_char,
+    status: *const c_char,
+    error: *mut CDefiantError,
+) -> *mut CDefiantPaymentListView {
+    let result = || -> Result<*mut CDefiantPaymentListView, RustDefiantError> {
+        let state = get_state()?;
+        let db = state.db.as_ref().ok_or(RustDefiantError::InternalError)?;
+        let redis = state.redis.as_ref().ok_or(RustDefiantError::InternalError)?;
+
+        let api_key_str = unsafe { CStr::from_ptr(api_key).to_str()? };
+
+        let cursor_str = if !cursor.is_null() {
+            Some(unsafe { CStr::from_ptr(cursor).to_str()?.to_string() })
+        } else {
+            None
+        };
+
+        let customer_id_uuid = if !customer_id.is_null() {
+            Some(unsafe { CStr::from_ptr(customer_id).to_str()?.parse()? })
+        } else {
+            None
+        };
+
+        let status_str = if !status.is_null() {
+            Some(unsafe { CStr::from_ptr(status).to_str()?.to_string() })
+        } else {
+            None
+        };
+
+        let payment_service = PaymentService::new(db.clone(), redis.clone());
+        let (payments, has_more, total) = tokio::runtime::Runtime::new()?
+            .block_on(payment_service.list_payments(
+                api_key_str,
+                cursor_str,
+                limit as i64,
+                customer_id_uuid,
+                status_str,
+            ))?;
+
+        Ok(build_payment_list_view(payments, has_more, total))
+    };
+
+    match result() {
+        Ok(list) => list,
+        Err(e) => {
+            if !error.is_null() {
+                unsafe {
+                    *error = e.into();
+                }
+            }
+            ptr::null_mut()
+        }
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn defiant_free_response(response: *mut CDefiantPaymentListView) {
+    if response.is_null() {
+        return;
+    }
+
+    unsafe {
+        let list = Box::from_raw(response);
+        if !list.buffer.is_null() {
+            drop(Box::from_raw(list.buffer as *mut ResponseBuffer));
+        }
+    }
+}
+
 // ==================== Global State ====================
 
 struct DefiantState {
@@ -571,4 +789,837 @@ pub extern "C" fn defiant_generate_crypto_address(
             ptr::null_mut()
         }
     }
-}
\ No newline at end of file
+}
+// ==================== Columnar Streaming API ====================
+
+#[repr(C)]
+pub struct CDefiantStrColumn {
+    pub data: *const c_char,
+    pub offsets: *const u32,
+}
+
+#[repr(C)]
+pub struct CDefiantPaymentChunk {
+    pub count: size_t,
+    pub amounts: *const int64_t,
+    pub ids: CDefiantStrColumn,
+    pub currencies: CDefiantStrColumn,
+    pub statuses: CDefiantStrColumn,
+    pub customer_ids: CDefiantStrColumn,
+    pub created_ats: CDefiantStrColumn,
+}
+
+// One string column under construction: concatenated values plus count+1
+// offsets. Buffers are reused across chunks so a 2M-payment export does
+// a handful of allocations total.
+#[derive(Default)]
+struct StrColumnBuffer {
+    data: String,
+    offsets: Vec<u32>,
+}
+
+impl StrColumnBuffer {
+    fn clear(&mut self) {
+        self.data.clear();
+        self.offsets.clear();
+        self.offsets.push(0);
+    }
+
+    fn push(&mut self, value: &str) {
+        self.data.push_str(value);
+        self.offsets.push(self.data.len() as u32);
+    }
+
+    fn column(&self) -> CDefiantStrColumn {
+        CDefiantStrColumn {
+            data: self.data.as_ptr() as *const c_char,
+            offsets: self.offsets.as_ptr(),
+        }
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn defiant_stream_payments_batched(
+    api_key: *const c_char,
+    chunk_size: size_t,
+    callback: extern "C" fn(*const CDefiantPaymentChunk, *mut c_void),
+    user_data: *mut c_void,
+    error: *mut CDefiantError,
+) -> bool {
+    let result = || -> Result<(), RustDefiantError> {
+        let state = get_state()?;
+        let db = state.db.as_ref().ok_or(RustDefiantError::InternalError)?;
+        let redis = state.redis.as_ref().ok_or(RustDefiantError::InternalError)?;
+
+        let api_key_str = unsafe { CStr::from_ptr(api_key).to_str()? };
+        let chunk_size = if chunk_size == 0 { 1024 } else { chunk_size };
+
+        let payment_service = PaymentService::new(db.clone(), redis.clone());
+        let runtime = tokio::runtime::Runtime::new()?;
+
+        let mut amounts: Vec<i64> = Vec::new();
+        let mut ids = StrColumnBuffer::default();
+        let mut currencies = StrColumnBuffer::default();
+        let mut statuses = StrColumnBuffer::default();
+        let mut customer_ids = StrColumnBuffer::default();
+        let mut created_ats = StrColumnBuffer::default();
+        ids.clear();
+        currencies.clear();
+        statuses.clear();
+        customer_ids.clear();
+        created_ats.clear();
+
+        let mut emit = |amounts: &mut Vec<i64>,
+                        ids: &mut StrColumnBuffer,
+                        currencies: &mut StrColumnBuffer,
+                        statuses: &mut StrColumnBuffer,
+                        customer_ids: &mut StrColumnBuffer,
+                        created_ats: &mut StrColumnBuffer| {
+            if amounts.is_empty() {
+                return;
+            }
+            let chunk = CDefiantPaymentChunk {
+                count: amounts.len() as size_t,
+                amounts: amounts.as_ptr(),
+                ids: ids.column(),
+                currencies: currencies.column(),
+                statuses: statuses.column(),
+                customer_ids: customer_ids.column(),
+                created_ats: created_ats.column(),
+            };
+            callback(&chunk, user_data);
+            amounts.clear();
+            ids.clear();
+            currencies.clear();
+            statuses.clear();
+            customer_ids.clear();
+            created_ats.clear();
+        };
+
+        // Walk the cursor in service-sized pages and coalesce them into
+        // caller-sized chunks
+        let mut cursor: Option<String> = None;
+        loop {
+            let (payments, has_more, _total) = runtime.block_on(payment_service.list_payments(
+                api_key_str,
+                cursor.clone(),
+                100,
+                None,
+                None,
+            ))?;
+
+            if payments.is_empty() {
+                break;
+            }
+            // Composite cursor: the id tie-breaker keeps same-timestamp
+            // rows from being dropped at page edges
+            cursor = payments
+                .last()
+                .map(|p| format!("{},{}", p.created_at.to_rfc3339(), p.id));
+
+            for payment in &payments {
+                amounts.push(payment.amount);
+                ids.push(&payment.id.to_string());
+                currencies.push(&payment.currency);
+                statuses.push(&payment.status.to_string());
+                customer_ids.push(
+                    &payment
+                        .customer_id
+                        .map(|id| id.to_string())
+                        .unwrap_or_default(),
+                );
+                created_ats.push(&payment.created_at.to_rfc3339());
+            }
+
+            if amounts.len() >= chunk_size || !has_more {
+                emit(
+                    &mut amounts,
+                    &mut ids,
+                    &mut currencies,
+                    &mut statuses,
+                    &mut customer_ids,
+                    &mut created_ats,
+                );
+            }
+
+            if !has_more {
+                break;
+            }
+        }
+
+        emit(
+            &mut amounts,
+            &mut ids,
+            &mut currencies,
+            &mut statuses,
+            &mut customer_ids,
+            &mut created_ats,
+        );
+
+        Ok(())
+    };
+
+    match result() {
+        Ok(()) => true,
+        Err(e) => {
+            if !error.is_null() {
+                unsafe {
+                    *error = e.into();
+                }
+            }
+            false
+        }
+    }
+}
+
+// ==================== Webhook Verification API ====================
+
+use hmac::{Hmac, Mac};
+use sha2::Sha256;
+
+type HmacSha256 = Hmac<Sha256>;
+
+// Signature headers are Stripe-style: "t=<unix>,v1=<hex>[,v1=<hex>...]",
+// with a bare hex digest accepted for legacy senders. The signed message
+// is "<t>.<payload>" when a timestamp is present, the raw payload
+// otherwise.
+struct ParsedSignature {
+    timestamp: Option<String>,
+    candidates: Vec<Vec<u8>>,
+}
+
+fn parse_signature_header(header: &str) -> Option<ParsedSignature> {
+    let mut parsed = ParsedSignature {
+        timestamp: None,
+        candidates: Vec::new(),
+    };
+    for part in header.split(',') {
+        let part = part.trim();
+        if let Some(value) = part.strip_prefix("t=") {
+            parsed.timestamp = Some(value.to_string());
+        } else if let Some(value) = part.strip_prefix("v1=") {
+            parsed.candidates.push(hex::decode(value).ok()?);
+        } else if parsed.candidates.is_empty() && !part.contains('=') {
+            parsed.candidates.push(hex::decode(part).ok()?);
+        }
+    }
+    if parsed.candidates.is_empty() {
+        return None;
+    }
+    Some(parsed)
+}
+
+fn constant_time_eq(a: &[u8], b: &[u8]) -> bool {
+    if a.len() != b.len() {
+        return false;
+    }
+    let mut diff = 0u8;
+    for (x, y) in a.iter().zip(b.iter()) {
+        diff |= x ^ y;
+    }
+    diff == 0
+}
+
+fn seeded_mac(secret: &[u8], parsed: &ParsedSignature) -> HmacSha256 {
+    let mut mac =
+        HmacSha256::new_from_slice(secret).expect("HMAC accepts any key length");
+    if let Some(timestamp) = &parsed.timestamp {
+        mac.update(timestamp.as_bytes());
+        mac.update(b".");
+    }
+    mac
+}
+
+fn verify_pair(secret: &[u8], payload: &[u8], header: &str) -> bool {
+    let Some(parsed) = parse_signature_header(header) else {
+        return false;
+    };
+    let mut mac = seeded_mac(secret, &parsed);
+    mac.update(payload);
+    let digest = mac.finalize().into_bytes();
+    parsed
+        .candidates
+        .iter()
+        .any(|candidate| constant_time_eq(candidate, &digest))
+}
+
+#[no_mangle]
+pub extern "C" fn defiant_verify_webhook_batch(
+    payloads: *const *const c_char,
+    payload_lengths: *const size_t,
+    signature_headers: *const *const c_char,
+    count: size_t,
+    webhook_secret: *const c_char,
+    result_bitmap: *mut u64,
+    error: *mut CDefiantError,
+) -> size_t {
+    let result = || -> Result<size_t, RustDefiantError> {
+        if payloads.is_null()
+            || payload_lengths.is_null()
+            || signature_headers.is_null()
+            || webhook_secret.is_null()
+            || result_bitmap.is_null()
+        {
+            return Err(RustDefiantError::ValidationError(
+                "null batch argument".to_string(),
+            ));
+        }
+        let secret = unsafe { CStr::from_ptr(webhook_secret).to_bytes() };
+
+        // Materialize the raw arrays as Send-able slices so the work can
+        // fan out across threads
+        let mut pairs: Vec<(&[u8], &str)> = Vec::with_capacity(count);
+        for i in 0..count {
+            let payload = unsafe {
+                std::slice::from_raw_parts(
+                    *payloads.add(i) as *const u8,
+                    *payload_lengths.add(i),
+                )
+            };
+            let header =
+                unsafe { CStr::from_ptr(*signature_headers.add(i)).to_str()? };
+            pairs.push((payload, header));
+        }
+
+        let threads = std::thread::available_parallelism()
+            .map(|n| n.get())
+            .unwrap_or(1)
+            .min(count.max(1));
+        let chunk_len = (count + threads - 1) / threads.max(1);
+
+        let mut results = vec![false; count];
+        if count > 0 {
+            std::thread::scope(|scope| {
+                for (chunk, out) in pairs
+                    .chunks(chunk_len)
+                    .zip(results.chunks_mut(chunk_len))
+                {
+                    scope.spawn(|| {
+                        for ((payload, header), slot) in
+                            chunk.iter().zip(out.iter_mut())
+                        {
+                            *slot = verify_pair(secret, payload, header);
+                        }
+                    });
+                }
+            });
+        }
+
+        let words = (count + 63) / 64;
+        let bitmap =
+            unsafe { std::slice::from_raw_parts_mut(result_bitmap, words) };
+        bitmap.fill(0);
+        let mut valid = 0usize;
+        for (i, ok) in results.iter().enumerate() {
+            if *ok {
+                bitmap[i / 64] |= 1u64 << (i % 64);
+                valid += 1;
+            }
+        }
+        Ok(valid)
+    };
+
+    match result() {
+        Ok(valid) => valid,
+        Err(e) => {
+            if !error.is_null() {
+                unsafe {
+                    *error = e.into();
+                }
+            }
+            usize::MAX
+        }
+    }
+}
+
+// Streaming verifier: the HMAC state lives behind an opaque handle so
+// callers can feed a large payload chunk by chunk
+pub struct DefiantWebhookVerifier {
+    mac: HmacSha256,
+    candidates: Vec<Vec<u8>>,
+}
+
+#[no_mangle]
+pub extern "C" fn defiant_webhook_verifier_new(
+    webhook_secret: *const c_char,
+    signature_header: *const c_char,
+    error: *mut CDefiantError,
+) -> *mut DefiantWebhookVerifier {
+    let result = || -> Result<DefiantWebhookVerifier, RustDefiantError> {
+        if webhook_secret.is_null() || signature_header.is_null() {
+            return Err(RustDefiantError::ValidationError(
+                "null verifier argument".to_string(),
+            ));
+        }
+        let secret = unsafe { CStr::from_ptr(webhook_secret).to_bytes() };
+        let header = unsafe { CStr::from_ptr(signature_header).to_str()? };
+        let parsed = parse_signature_header(header).ok_or_else(|| {
+            RustDefiantError::ValidationError(
+                "malformed signature header".to_string(),
+            )
+        })?;
+        Ok(DefiantWebhookVerifier {
+            mac: seeded_mac(secret, &parsed),
+            candidates: parsed.candidates,
+        })
+    };
+
+    match result() {
+        Ok(verifier) => Box::into_raw(Box::new(verifier)),
+        Err(e) => {
+            if !error.is_null() {
+                unsafe {
+                    *error = e.into();
+                }
+            }
+            ptr::null_mut()
+        }
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn defiant_webhook_verifier_update(
+    verifier: *mut DefiantWebhookVerifier,
+    data: *const u8,
+    length: size_t,
+) {
+    if verifier.is_null() || data.is_null() {
+        return;
+    }
+    let verifier = unsafe { &mut *verifier };
+    let chunk = unsafe { std::slice::from_raw_parts(data, length) };
+    verifier.mac.update(chunk);
+}
+
+#[no_mangle]
+pub extern "C" fn defiant_webhook_verifier_finish(
+    verifier: *mut DefiantWebhookVerifier,
+) -> bool {
+    if verifier.is_null() {
+        return false;
+    }
+    let verifier = unsafe { Box::from_raw(verifier) };
+    let digest = verifier.mac.finalize().into_bytes();
+    verifier
+        .candidates
+        .iter()
+        .any(|candidate| constant_time_eq(candidate, &digest))
+}
+
+// ==================== Client Handle API ====================
+
+// Everything the per-call entry points rebuild on every invocation,
+// constructed once and amortized across a batch job: the tokio runtime
+// (Runtime::new() per call was the dominant cost), the pooled sqlx and
+// Redis connections held through the services, and the api_key.
+#[repr(C)]
+pub struct CDefiantClientOptions {
+    pub worker_threads: i32,
+}
+
+pub struct DefiantClient {
+    api_key: String,
+    runtime: tokio::runtime::Runtime,
+    payment_service: PaymentService,
+    customer_service: CustomerService,
+}
+
+#[no_mangle]
+pub extern "C" fn defiant_client_new(
+    api_key: *const c_char,
+    options: *const CDefiantClientOptions,
+    error: *mut CDefiantError,
+) -> *mut DefiantClient {
+    let result = || -> Result<DefiantClient, RustDefiantError> {
+        let state = get_state()?;
+        let db = state.db.as_ref().ok_or(RustDefiantError::InternalError)?;
+        let redis = state.redis.as_ref().ok_or(RustDefiantError::InternalError)?;
+
+        let api_key_str = unsafe { CStr::from_ptr(api_key).to_str()? };
+
+        let worker_threads = if options.is_null() {
+            0
+        } else {
+            unsafe { (*options).worker_threads }
+        };
+        let mut builder = tokio::runtime::Builder::new_multi_thread();
+        builder.enable_all();
+        if worker_threads > 0 {
+            builder.worker_threads(worker_threads as usize);
+        }
+        let runtime = builder.build()?;
+
+        Ok(DefiantClient {
+            api_key: api_key_str.to_string(),
+            runtime,
+            payment_service: PaymentService::new(db.clone(), redis.clone()),
+            customer_service: CustomerService::new(db.clone(), redis.clone()),
+        })
+    };
+
+    match result() {
+        Ok(client) => Box::into_raw(Box::new(client)),
+        Err(e) => {
+            if !error.is_null() {
+                unsafe {
+                    *error = e.into();
+                }
+            }
+            ptr::null_mut()
+        }
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn defiant_client_free(client: *mut DefiantClient) {
+    if client.is_null() {
+        return;
+    }
+    unsafe {
+        drop(Box::from_raw(client));
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn defiant_create_payment_with_client(
+    client: *mut DefiantClient,
+    amount: int64_t,
+    currency: *const c_char,
+    payment_method: *const c_char,
+    customer_id: *const c_char,
+    description: *const c_char,
+    metadata: *const c_char,
+    error: *mut CDefiantError,
+) -> *mut CDefiantPayment {
+    let result = || -> Result<CDefiantPayment, RustDefiantError> {
+        if client.is_null() {
+            return Err(RustDefiantError::ValidationError(
+                "null client handle".to_string(),
+            ));
+        }
+        let client = unsafe { &*client };
+
+        let currency_str = unsafe { CStr::from_ptr(currency).to_str()? };
+        let payment_method_str = unsafe { CStr::from_ptr(payment_method).to_str()? };
+
+        let customer_id_uuid = if !customer_id.is_null() {
+            Some(unsafe { CStr::from_ptr(customer_id).to_str()?.parse()? })
+        } else {
+            None
+        };
+
+        let description_str = if !description.is_null() {
+            Some(unsafe { CStr::from_ptr(description).to_str()?.to_string() })
+        } else {
+            None
+        };
+
+        let metadata_json = if !metadata.is_null() {
+            let metadata_str = unsafe { CStr::from_ptr(metadata).to_str()? };
+            Some(serde_json::from_str(metadata_str)?)
+        } else {
+            None
+        };
+
+        let request = CreatePaymentRequest {
+            amount,
+            currency: currency_str.to_string(),
+            payment_method: payment_method_str.parse()?,
+            description: description_str,
+            metadata: metadata_json,
+            customer_id: customer_id_uuid,
+            source: None,
+        };
+
+        request.validate()?;
+
+        let payment = client.runtime.block_on(
+            client
+                .payment_service
+                .create_payment(request, &client.api_key),
+        )?;
+
+        Ok(payment.into())
+    };
+
+    match result() {
+        Ok(payment) => Box::into_raw(Box::new(payment)),
+        Err(e) => {
+            if !error.is_null() {
+                unsafe {
+                    *error = e.into();
+                }
+            }
+            ptr::null_mut()
+        }
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn defiant_get_payment_with_client(
+    client: *mut DefiantClient,
+    payment_id: *const c_char,
+    error: *mut CDefiantError,
+) -> *mut CDefiantPayment {
+    let result = || -> Result<CDefiantPayment, RustDefiantError> {
+        if client.is_null() {
+            return Err(RustDefiantError::ValidationError(
+                "null client handle".to_string(),
+            ));
+        }
+        let client = unsafe { &*client };
+
+        let payment_id_uuid = unsafe { CStr::from_ptr(payment_id).to_str()? }.parse()?;
+
+        let payment = client.runtime.block_on(
+            client
+                .payment_service
+                .get_payment(payment_id_uuid, &client.api_key),
+        )?;
+
+        Ok(payment.into())
+    };
+
+    match result() {
+        Ok(payment) => Box::into_raw(Box::new(payment)),
+        Err(e) => {
+            if !error.is_null() {
+                unsafe {
+                    *error = e.into();
+                }
+            }
+            ptr::null_mut()
+        }
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn defiant_create_customer_with_client(
+    client: *mut DefiantClient,
+    email: *const c_char,
+    name: *const c_char,
+    phone: *const c_char,
+    description: *const c_char,
+    metadata: *const c_char,
+    error: *mut CDefiantError,
+) -> *mut CDefiantCustomer {
+    let result = || -> Result<CDefiantCustomer, RustDefiantError> {
+        if client.is_null() {
+            return Err(RustDefiantError::ValidationError(
+                "null client handle".to_string(),
+            ));
+        }
+        let client = unsafe { &*client };
+
+        let email_str = unsafe { CStr::from_ptr(email).to_str()? };
+
+        let name_str = if !name.is_null() {
+            Some(unsafe { CStr::from_ptr(name).to_str()?.to_string() })
+        } else {
+            None
+        };
+
+        let phone_str = if !phone.is_null() {
+            Some(unsafe { CStr::from_ptr(phone).to_str()?.to_string() })
+        } else {
+            None
+        };
+
+        let description_str = if !description.is_null() {
+            Some(unsafe { CStr::from_ptr(description).to_str()?.to_string() })
+        } else {
+            None
+        };
+
+        let metadata_json = if !metadata.is_null() {
+            let metadata_str = unsafe { CStr::from_ptr(metadata).to_str()? };
+            Some(serde_json::from_str(metadata_str)?)
+        } else {
+            None
+        };
+
+        let request = CreateCustomerRequest {
+            email: email_str.to_string(),
+            name: name_str,
+            phone: phone_str,
+            description: description_str,
+            metadata: metadata_json,
+            payment_method: None,
+            address: None,
+        };
+
+        request.validate()?;
+
+        let customer = client.runtime.block_on(
+            client
+                .customer_service
+                .create_customer(request, &client.api_key),
+        )?;
+
+        Ok(customer.into())
+    };
+
+    match result() {
+        Ok(customer) => Box::into_raw(Box::new(customer)),
+        Err(e) => {
+            if !error.is_null() {
+                unsafe {
+                    *error = e.into();
+                }
+            }
+            ptr::null_mut()
+        }
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn defiant_list_payments_view_with_client(
+    client: *mut DefiantClient,
+    cursor: *const c_char,
+    limit: c_int,
+    customer_id: *const c_char,
+    status: *const c_char,
+    error: *mut CDefiantError,
+) -> *mut CDefiantPaymentListView {
+    let result = || -> Result<*mut CDefiantPaymentListView, RustDefiantError> {
+        if client.is_null() {
+            return Err(RustDefiantError::ValidationError(
+                "null client handle".to_string(),
+            ));
+        }
+        let client = unsafe { &*client };
+
+        let cursor_str = if !cursor.is_null() {
+            Some(unsafe { CStr::from_ptr(cursor).to_str()?.to_string() })
+        } else {
+            None
+        };
+
+        let customer_id_uuid = if !customer_id.is_null() {
+            Some(unsafe { CStr::from_ptr(customer_id).to_str()?.parse()? })
+        } else {
+            None
+        };
+
+        let status_str = if !status.is_null() {
+            Some(unsafe { CStr::from_ptr(status).to_str()?.to_string() })
+        } else {
+            None
+        };
+
+        let (payments, has_more, total) =
+            client.runtime.block_on(client.payment_service.list_payments(
+                &client.api_key,
+                cursor_str,
+                limit as i64,
+                customer_id_uuid,
+                status_str,
+            ))?;
+
+        Ok(build_payment_list_view(payments, has_more, total))
+    };
+
+    match result() {
+        Ok(list) => list,
+        Err(e) => {
+            if !error.is_null() {
+                unsafe {
+                    *error = e.into();
+                }
+            }
+            ptr::null_mut()
+        }
+    }
+}
+
+// ==================== Analytics Delta Stream ====================
+
+pub type CDefiantStreamCallback =
+    extern "C" fn(*const c_char, *const c_char, *mut c_void);
+
+// Tails the events table for "analytics.delta" rows belonging to the
+// key's merchant and hands each one to the callback, so a consumer can
+// fold counter deltas into a defiant_get_analytics snapshot instead of
+// re-requesting the summary. Blocks the calling thread for the life of
+// the stream; the watermark is (created_at, id) so bursts sharing a
+// timestamp are never skipped.
+#[no_mangle]
+pub extern "C" fn defiant_stream_analytics_deltas(
+    api_key: *const c_char,
+    callback: CDefiantStreamCallback,
+    user_data: *mut c_void,
+    error: *mut CDefiantError,
+) -> bool {
+    let result = || -> Result<(), RustDefiantError> {
+        let state = get_state()?;
+        let db = state.db.as_ref().ok_or(RustDefiantError::InternalError)?;
+
+        let api_key_str = unsafe { CStr::from_ptr(api_key).to_str()? };
+        let runtime = tokio::runtime::Runtime::new()?;
+
+        let merchant = runtime.block_on(async {
+            sqlx::query!(
+                "SELECT m.id FROM merchants m
+                 JOIN api_keys ak ON m.id = ak.merchant_id
+                 WHERE ak.key = $1 AND ak.active = true
+                 AND m.active = true",
+                api_key_str
+            )
+            .fetch_optional(&db.pool)
+            .await
+        })?
+        .ok_or_else(|| {
+            RustDefiantError::AuthenticationError("Invalid API key".to_string())
+        })?;
+
+        let event_type = CString::new("analytics.delta")?;
+
+        runtime.block_on(async {
+            let mut watermark_ts = chrono::Utc::now();
+            let mut watermark_id = uuid::Uuid::nil();
+            loop {
+                let rows = sqlx::query!(
+                    "SELECT id, data, created_at FROM events
+                     WHERE merchant_id = $1 AND type = 'analytics.delta'
+                     AND (created_at, id) > ($2, $3)
+                     ORDER BY created_at, id
+                     LIMIT 100",
+                    merchant.id,
+                    watermark_ts,
+                    watermark_id,
+                )
+                .fetch_all(&db.pool)
+                .await?;
+
+                let drained = rows.len() < 100;
+                for row in rows {
+                    if let Some(created_at) = row.created_at {
+                        watermark_ts = created_at;
+                    }
+                    watermark_id = row.id;
+                    let data = CString::new(row.data.to_string())
+                        .unwrap_or_default();
+                    callback(event_type.as_ptr(), data.as_ptr(), user_data);
+                }
+
+                if drained {
+                    tokio::time::sleep(std::time::Duration::from_secs(1)).await;
+                }
+            }
+            #[allow(unreachable_code)]
+            Ok::<(), RustDefiantError>(())
+        })
+    };
+
+    match result() {
+        Ok(()) => true,
+        Err(e) => {
+            if !error.is_null() {
+                unsafe {
+                    *error = e.into();
+                }
+            }
+            false
+        }
+    }
+}